@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <fonts.h>
+#include "image.h"
 
 #include "stm32f4xx_hal.h"
 
@@ -37,6 +38,15 @@
 #define DDDD_WHITE	0x2104
 #define	BLACK		0x0000
 #define color565(r, g, b) ((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | (((b) & 0xF8) >> 3))
+#define rgb666(r, g, b) {.red = (r) & 0xFC, .green = (g) & 0xFC, .blue = (b) & 0xFC}
+
+/* Pixel bytes as sent to the display in RGB666 mode, the 2 low bits of each byte are ignored */
+typedef struct
+{
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+} ILI9488_Color_t;
 
 typedef enum
 {
@@ -57,10 +67,13 @@ void ILI9488_Orientation(ILI9488_Orientation_e orientation);
 
 void ILI9488_FillArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
 void ILI9488_Pixel(uint16_t x, uint16_t y, uint16_t color);
+void ILI9488_FillAreaRGB666(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const ILI9488_Color_t *color);
+void ILI9488_PixelRGB666(uint16_t x, uint16_t y, const ILI9488_Color_t *color);
 void ILI9488_FillScreen(uint16_t bgcolor);
 void ILI9488_DrawBorder(int16_t x, int16_t y, int16_t w, int16_t h, int16_t t, uint16_t color);
 void ILI9488_DrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
 void ILI9488_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+void ILI9488_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
 
 void ILI9488_WChar(uint16_t x, uint16_t y, char ch, sFONT font, uint8_t size, uint16_t color, uint16_t bgcolor);
 void ILI9488_WString(uint16_t x, uint16_t y, const char *str, sFONT font, uint8_t size, uint16_t color,
@@ -68,4 +81,6 @@ void ILI9488_WString(uint16_t x, uint16_t y, const char *str, sFONT font, uint8_
 void ILI9488_CString(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, const char *str, sFONT font, uint8_t size,
                      uint16_t color, uint16_t bgcolor);
 void ILI9488_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *data, uint32_t size);
+void ILI9488_DrawCompressedImage(uint16_t x, uint16_t y, const image_t *image);
+uint32_t ILI9488_GetBytesSent(void);
 #endif /* INC_ILI9488_H */
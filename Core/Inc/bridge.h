@@ -0,0 +1,52 @@
+/*
+ * bridge.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_BRIDGE_H_
+#define INC_BRIDGE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t bytes; // Bytes forwarded to the host
+    uint32_t dropped; // Bytes overwritten in the reception ring before being sent, or refused by the link
+    uint32_t transfers;
+} bridge_stats_t;
+
+/**
+ * @brief Enable or disable the forwarding of the raw lidar bytes to the host link.
+ * @param enable True to start forwarding, the statistics are reset.
+ *
+ * The bytes are sent unchanged, the host sees the lidar as if it was connected to its own serial port. The scan
+ * is still started from the map screen.
+ */
+void BRIDGE_Enable(bool enable);
+bool BRIDGE_IsEnabled(void);
+
+/**
+ * @brief Account for bytes received from the lidar, must be called from `RPLIDAR_OnRawData`.
+ * @param data Received bytes, in the DMA reception ring.
+ * @param length Number of bytes received.
+ */
+void BRIDGE_AddData(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Send the received bytes to the link once it is idle, must be called periodically from the main loop.
+ *
+ * The link reads the bytes directly from the DMA reception ring, nothing is copied. When the link is too slow
+ * and the ring wraps around over unsent bytes, they are dropped.
+ */
+void BRIDGE_Update(void);
+
+/**
+ * @brief Get the forwarding statistics.
+ * @param stats User buffer where the statistics will be stored.
+ */
+void BRIDGE_GetStats(bridge_stats_t *stats);
+
+#endif /* INC_BRIDGE_H_ */
@@ -0,0 +1,44 @@
+/*
+ * cdc.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_CDC_H_
+#define INC_CDC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Start the USB full speed device, seen by the host as a virtual serial port (CDC ACM).
+ *
+ * The OTG_FS core is driven through its registers, PA11 and PA12 are configured here and VBUS is not sensed.
+ * The data sent by the host is discarded.
+ */
+void CDC_Init(void);
+
+/**
+ * @brief Start sending a buffer to the host.
+ * @param data Buffer to send, it must not be modified until the transfer is complete.
+ * @param length Number of bytes to send.
+ * @return True if the transfer is started, false if the device is not configured, suspended or still busy.
+ *
+ * The end of the transfer is reported with `LINK_TransmitComplete`, also when the transfer is aborted by a
+ * reset or a suspend of the bus.
+ */
+bool CDC_Transmit(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Check if the host has configured the device.
+ * @return True once the host has opened the device, false after a reset or a suspend of the bus.
+ */
+bool CDC_IsConnected(void);
+
+/**
+ * @brief Handle the OTG_FS interrupt, must be called from `OTG_FS_IRQHandler`.
+ */
+void CDC_IRQHandler(void);
+
+#endif /* INC_CDC_H_ */
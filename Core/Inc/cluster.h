@@ -0,0 +1,62 @@
+/*
+ * cluster.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_CLUSTER_H_
+#define INC_CLUSTER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "rplidar.h"
+
+#define CLUSTER_SIZE_MAX 8
+
+typedef struct
+{
+    bool enabled;
+    uint16_t break_distance; // Range jump starting a new cluster in mm, grows by 1/16 of the range
+    uint16_t break_angle; // Angle gap starting a new cluster, Q6 degrees
+    uint8_t size_min; // Clusters with fewer samples are rejected (1 to CLUSTER_SIZE_MAX)
+} cluster_config_t;
+
+typedef struct
+{
+    uint32_t processed;
+    uint32_t rejected; // Samples of rejected clusters
+    uint32_t clusters; // Accepted clusters
+} cluster_stats_t;
+
+typedef struct
+{
+    rplidar_measurement_t measurement;
+    uint32_t timestamp;
+    uint16_t cluster; // Label of the cluster the sample belongs to
+} cluster_sample_t;
+
+/**
+ * @brief Drop the pending cluster, to be called when the stream of samples is interrupted.
+ */
+void CLUSTER_Reset(void);
+
+/**
+ * @brief Pass a sample through the clustering stage.
+ * @param measurement Next sample of the sweep, in angle order.
+ * @param timestamp Time of the measurement (DWT cycles).
+ * @param samples User buffer of CLUSTER_SIZE_MAX samples where the released samples will be stored.
+ * @return Number of samples released.
+ *
+ * Consecutive samples are in the same cluster unless the range jumps or the angle gap between them is too
+ * large. Samples are held until their cluster reaches the minimum size, so isolated returns (dust,
+ * reflections) are dropped before reaching the map. A single pass, the stage costs a few integer operations
+ * per sample and delays the samples by at most size_min - 1 samples.
+ */
+uint8_t CLUSTER_Process(const rplidar_measurement_t *measurement, uint32_t timestamp, cluster_sample_t *samples);
+
+void CLUSTER_SetConfig(const cluster_config_t *config);
+void CLUSTER_GetConfig(cluster_config_t *config);
+void CLUSTER_GetStats(cluster_stats_t *stats);
+
+#endif /* INC_CLUSTER_H_ */
@@ -0,0 +1,70 @@
+/*
+ * codec.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_CODEC_H_
+#define INC_CODEC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sweep.h"
+
+#define CODEC_SYNC 0xA5
+#define CODEC_VERSION 1
+#define CODEC_HEADER_SIZE 20
+#define CODEC_CRC_SIZE 2
+#define CODEC_CRC_INIT 0xFFFF
+
+/* Worst case size of an encoded sweep: two 3-byte varints and 6 quality bits per sample */
+#define CODEC_SWEEP_SIZE_MAX(count) (CODEC_HEADER_SIZE + (count) * 6 + ((count) * 6 + 7) / 8 + CODEC_CRC_SIZE)
+
+/**
+ * @brief Encode a sweep in the compact binary format.
+ * @param frame Sweep to encode.
+ * @param buffer User buffer where the encoded sweep will be stored.
+ * @param size Size of the buffer in bytes, `CODEC_SWEEP_SIZE_MAX` is always enough.
+ * @return Encoded size in bytes, 0 if the buffer is too small.
+ *
+ * Format (little endian):
+ * - header: sync, version, flags, constant quality, sample count, sweep index, start timestamp and duration in
+ *   DWT cycles, payload size
+ * - payload: per sample, angle and distance differences from the previous sample as zigzag varints, then the
+ *   qualities packed on 6 bits unless they are all equal
+ * - CRC-16/CCITT of the header and the payload
+ *
+ * Sample timestamps are not stored, they are interpolated between the start and the end of the sweep when decoding.
+ */
+uint16_t CODEC_EncodeSweep(const sweep_frame_t *frame, uint8_t *buffer, uint16_t size);
+
+/**
+ * @brief Decode a sweep encoded with `CODEC_EncodeSweep`.
+ * @param buffer Encoded sweep.
+ * @param length Number of bytes available in the buffer.
+ * @param frame User buffer where the decoded sweep will be stored.
+ * @return Size of the encoded sweep in bytes, 0 if it is incomplete, corrupted or too large for the frame.
+ */
+uint16_t CODEC_DecodeSweep(const uint8_t *buffer, uint16_t length, sweep_frame_t *frame);
+
+/**
+ * @brief Decode the next sweep of a byte stream, resynchronizing on the sync byte after an error.
+ * @param buffer Received bytes.
+ * @param length Number of bytes available in the buffer.
+ * @param frame User buffer where the decoded sweep will be stored.
+ * @param found Pointer set to true if a sweep was decoded.
+ * @return Number of bytes consumed, skipped bytes included. The bytes left start an incomplete sweep.
+ */
+uint16_t CODEC_DecodeStream(const uint8_t *buffer, uint16_t length, sweep_frame_t *frame, bool *found);
+
+/**
+ * @brief Compute a CRC-16/CCITT (polynomial 0x1021).
+ * @param data Data to add.
+ * @param length Size of the data in bytes.
+ * @param crc Previous CRC value to continue, or `CODEC_CRC_INIT`.
+ * @return Updated CRC value.
+ */
+uint16_t CODEC_Crc16(const uint8_t *data, uint16_t length, uint16_t crc);
+
+#endif /* INC_CODEC_H_ */
@@ -9,10 +9,12 @@
 #define INC_DIAG_H_
 
 #include <stdint.h>
+#include "image.h"
 
-extern const uint8_t cross[1728];
+extern const image_t cross;
 
 void DIAG_Show(void);
 void DIAG_Touch(uint16_t x, uint16_t y);
+void DIAG_Update(void);
 
 #endif /* INC_DIAG_H_ */
@@ -0,0 +1,51 @@
+/*
+ * export.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_EXPORT_H_
+#define INC_EXPORT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sweep.h"
+
+#define EXPORT_BUFFER_SIZE 2560 // A 720 samples sweep takes about 2 KB
+
+typedef struct
+{
+    uint32_t sweeps; // Sweeps handed to the link
+    uint32_t dropped; // Sweeps lost because the link was too slow or not connected
+    uint32_t bytes;
+} export_stats_t;
+
+/**
+ * @brief Enable or disable the streaming of the sweeps to the host link.
+ * @param enable True to start streaming, the statistics are reset.
+ */
+void EXPORT_Enable(bool enable);
+bool EXPORT_IsEnabled(void);
+
+/**
+ * @brief Queue a completed sweep for the host.
+ * @param frame Sweep to send.
+ *
+ * The sweep is encoded with `CODEC_EncodeSweep` in the buffer being filled, while the other buffer is sent by the
+ * link. It is dropped rather than waiting when both buffers are in use, so the lidar path is never blocked.
+ */
+void EXPORT_AddSweep(const sweep_frame_t *frame);
+
+/**
+ * @brief Hand the filled buffer to the link once it is idle, must be called periodically from the main loop.
+ */
+void EXPORT_Update(void);
+
+/**
+ * @brief Get the streaming statistics.
+ * @param stats User buffer where the statistics will be stored.
+ */
+void EXPORT_GetStats(export_stats_t *stats);
+
+#endif /* INC_EXPORT_H_ */
@@ -0,0 +1,44 @@
+/*
+ * filter.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_FILTER_H_
+#define INC_FILTER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "rplidar.h"
+
+#define FILTER_BINS 720 // 0.5° each
+
+/**
+ * @brief Forget the filtered range of every angle.
+ */
+void FILTER_Reset(void);
+
+/**
+ * @brief Enable or disable the filter, the samples are left untouched while disabled.
+ * @param enable True to filter.
+ */
+void FILTER_Enable(bool enable);
+bool FILTER_IsEnabled(void);
+
+/**
+ * @brief Replace the distance of a sample by the filtered range of its angle.
+ * @param measurement Sample to filter, modified in place.
+ *
+ * Each angle bin keeps an exponential moving average over the revolutions, weighted by the sample quality.
+ * A jump larger than the noise restarts the average so that moving objects are not smeared.
+ */
+void FILTER_Apply(rplidar_measurement_t *measurement);
+
+/**
+ * @brief Get the stabilized range profile.
+ * @return Filtered range of each bin (Q2 mm, 0 if never measured), FILTER_BINS entries.
+ */
+const uint16_t* FILTER_GetProfile(void);
+
+#endif /* INC_FILTER_H_ */
@@ -0,0 +1,59 @@
+/*
+ * image.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_IMAGE_H_
+#define INC_IMAGE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define IMAGE_TOKEN_RUN 0x80 // Set for a run of one color, clear for literal colors
+#define IMAGE_TOKEN_LENGTH_MAX 128 // Pixels per token
+
+/* Image compressed with tools/image2c.py */
+typedef struct
+{
+    uint16_t width;
+    uint16_t height;
+    uint16_t colors; // Palette entries, 256 at most
+    const uint8_t *palette; // 3 bytes per color, in the display order (RGB666)
+    const uint8_t *data; // Tokens
+    uint16_t size; // Size of the tokens in bytes
+} image_t;
+
+typedef struct
+{
+    const image_t *image;
+    uint16_t idx; // Next byte of the tokens
+    uint8_t remaining; // Pixels left in the current token
+    uint8_t color; // Palette index of the current run
+    bool literal;
+} image_decoder_t;
+
+/**
+ * @brief Start decoding an image from its first pixel.
+ * @param decoder User buffer where the decoding state will be stored.
+ * @param image Image to decode.
+ *
+ * Format: a sequence of tokens. The low 7 bits of the token byte are the number of pixels minus one. A run token
+ * (`IMAGE_TOKEN_RUN` set) is followed by one palette index used for all its pixels, a literal token by one palette
+ * index per pixel.
+ */
+void IMAGE_Start(image_decoder_t *decoder, const image_t *image);
+
+/**
+ * @brief Decode the next pixels of the image.
+ * @param decoder Decoding state, see `IMAGE_Start`.
+ * @param buffer User buffer where the pixels will be stored, 3 bytes each.
+ * @param size Size of the buffer in bytes.
+ * @return Number of bytes written, always whole pixels. 0 once the image is complete or if its data is invalid.
+ *
+ * The image can be decoded in chunks of any size, the decoder resumes in the middle of a token.
+ */
+uint16_t IMAGE_Decode(image_decoder_t *decoder, uint8_t *buffer, uint16_t size);
+
+#endif /* INC_IMAGE_H_ */
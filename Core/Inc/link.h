@@ -0,0 +1,44 @@
+/*
+ * link.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_LINK_H_
+#define INC_LINK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Start sending a buffer to the host.
+ * @param data Buffer to send, it must not be modified until the transfer is complete.
+ * @param length Number of bytes to send.
+ * @return True if the transfer is started, false if the link is busy or not connected.
+ */
+bool LINK_Transmit(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Check if a transfer is in progress.
+ * @return True until the transport reports the end of the last transfer.
+ */
+bool LINK_IsBusy(void);
+
+/**
+ * @brief Report the end of the transfer, must be called by the transport (usually from its interrupt).
+ */
+void LINK_TransmitComplete(void);
+
+/**
+ * @brief Transport hook called to start a transfer.
+ * @param data Buffer to send.
+ * @param length Number of bytes to send.
+ * @return True if the transport accepted the buffer.
+ *
+ * Implemented by the USB CDC device in `cdc.c` with `CDC_Transmit`, which calls `LINK_TransmitComplete` when the
+ * transfer ends or is aborted. It refuses the transfer until the host has configured the device.
+ */
+bool LINK_Send(const uint8_t *data, uint16_t length);
+
+#endif /* INC_LINK_H_ */
@@ -8,6 +8,7 @@
 #ifndef INC_MAP_H_
 #define INC_MAP_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 
 typedef enum
@@ -17,9 +18,23 @@ typedef enum
 
 typedef enum
 {
-    MAP_PERSIST_OFF, MAP_PERSIST_ON, MAP_PERSIST_ONESHOT, MAP_PERSIST_MAX
+    MAP_PERSIST_OFF, MAP_PERSIST_ON, MAP_PERSIST_ACCUMULATE, MAP_PERSIST_MAX
 } map_persistence_mode_e;
 
+typedef enum
+{
+    MAP_RENDER_POINTS, MAP_RENDER_LINES, MAP_RENDER_HEATMAP, MAP_RENDER_MAX
+} map_render_mode_e;
+
+typedef struct
+{
+    uint16_t sample_count;
+    uint16_t sample_capacity;
+    uint32_t sample_dropped;
+    uint16_t cells_updated; // Cells drawn by the last accumulated snapshot or heatmap revolution
+    uint32_t cells_dropped; // Samples not accumulated because the cell table was crowded
+} map_stats_t;
+
 void MAP_Show(void);
 void MAP_DrawMenu(void);
 void MAP_DrawSamples(void);
@@ -27,6 +42,11 @@ void MAP_Touch(uint16_t x, uint16_t y);
 void MAP_SetScaleMode(map_scale_mode_e mode);
 void MAP_SetQuality(uint8_t quality);
 void MAP_SetPersistanceMode(map_persistence_mode_e mode);
+void MAP_SetRenderMode(map_render_mode_e mode);
+map_render_mode_e MAP_GetRenderMode(void);
+void MAP_SetTracking(bool enable);
+bool MAP_IsTracking(void);
 void MAP_ClearPoints(bool erase_buffers);
+void MAP_GetStats(map_stats_t *stats);
 
 #endif /* INC_MAP_H_ */
@@ -0,0 +1,63 @@
+/*
+ * match.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_MATCH_H_
+#define INC_MATCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sweep.h"
+
+#define MATCH_POINTS_MAX 360 // Samples of a sweep used for the alignment
+#define MATCH_ITERATIONS_MAX 20
+#define MATCH_CYCLES_PER_SEARCH 600 // Estimate on the F411 for one correspondence and its normal, atan2f dominates
+
+typedef struct
+{
+    float x; // mm, same orientation as the map (x to the right, y downward)
+    float y;
+    float theta; // rad, from the x axis toward the y axis
+} match_pose_t;
+
+typedef struct
+{
+    uint32_t matched; // Sweeps aligned on the keyframe
+    uint32_t failed; // Sweeps without enough correspondences, the pose is kept
+    uint32_t keyframes;
+    uint16_t inliers; // Correspondences of the last match
+    uint8_t iterations; // Iterations of the last match
+    uint16_t searches; // Correspondence searches of the last match, the cost of the alignment
+} match_stats_t;
+
+/**
+ * @brief Restart tracking, the next sweep defines the map frame.
+ */
+void MATCH_Reset(void);
+
+/**
+ * @brief Estimate the pose of a new sweep in the map frame.
+ * @param sweep Completed sweep, samples ordered by angle.
+ * @return True if the sweep has been aligned, false if the pose could not be updated.
+ *
+ * The sweep is aligned on the current keyframe by point-to-line ICP. Correspondences are found by projecting
+ * each sample on the angle bins of the keyframe, so the cost is linear in the number of samples. The keyframe
+ * is replaced once the sensor has moved or turned enough from it.
+ *
+ * A match costs at most MATCH_ITERATIONS_MAX * MATCH_POINTS_MAX searches, about 45 ms at 96 MHz, and a few
+ * iterations once the pose is tracked.
+ */
+bool MATCH_AddSweep(const sweep_frame_t *sweep);
+
+/**
+ * @brief Get the last estimated pose of the sensor in the map frame.
+ * @param pose Pointer where the pose will be stored.
+ */
+void MATCH_GetPose(match_pose_t *pose);
+
+void MATCH_GetStats(match_stats_t *stats);
+
+#endif /* INC_MATCH_H_ */
@@ -9,14 +9,15 @@
 #define INC_MENU_H_
 
 #include <stdint.h>
+#include "image.h"
 
 typedef enum
 {
     MENU_SCREEN_MAIN, MENU_SCREEN_MAP, MENU_SCREEN_DIAG
 } menu_screen_e;
 
-extern const uint8_t logo[12288];
-extern const uint8_t volume[1728];
+extern const image_t logo;
+extern const image_t volume;
 
 void MENU_SetScreen(menu_screen_e screen);
 void MENU_HandleTouch(void);
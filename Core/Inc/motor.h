@@ -0,0 +1,71 @@
+/*
+ * motor.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_MOTOR_H_
+#define INC_MOTOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum
+{
+    MOTOR_PROFILE_DENSE, MOTOR_PROFILE_BALANCED, MOTOR_PROFILE_FAST, MOTOR_PROFILE_MAX
+} motor_profile_e;
+
+/**
+ * @brief Enable or disable the speed regulation.
+ * @param enable True to start regulating, false to stop.
+ *
+ * Regulation must only be enabled while scanning, the revolution rate is measured from the scan start flags.
+ */
+void MOTOR_Enable(bool enable);
+
+/**
+ * @brief Run the speed regulation, must be called periodically from the main loop.
+ *
+ * The revolution rate is measured over the revolutions received since the last correction and the motor
+ * command is moved toward the target by an integral correction. After enabling, the measure starts at the first
+ * revolution of the new scan and the first correction waits for the following ones.
+ */
+void MOTOR_Update(void);
+
+/**
+ * @brief Select a predefined operating point.
+ * @param profile Dense (slow, best angular resolution), balanced or fast (best refresh rate).
+ */
+void MOTOR_SetProfile(motor_profile_e profile);
+motor_profile_e MOTOR_GetProfile(void);
+
+/**
+ * @brief Set the target motor speed.
+ * @param rpm Target speed in revolutions per minute, clamped to the supported range.
+ */
+void MOTOR_SetTargetRpm(uint16_t rpm);
+uint16_t MOTOR_GetTargetRpm(void);
+
+/**
+ * @brief Set the target speed from the wanted angular resolution.
+ * @param resolution_mdeg Angle between two consecutive samples in millidegrees.
+ *
+ * The angular resolution is the sample rate of the current scan mode divided by the revolution rate, so a
+ * finer resolution means a slower refresh rate.
+ */
+void MOTOR_SetAngularResolution(uint16_t resolution_mdeg);
+
+/**
+ * @brief Get the angular resolution at the measured speed.
+ * @return Angle between two consecutive samples in millidegrees, 0 if unknown.
+ */
+uint16_t MOTOR_GetAngularResolution(void);
+
+/**
+ * @brief Get the last measured motor speed.
+ * @return Speed in revolutions per minute, 0 if not measured yet.
+ */
+uint16_t MOTOR_GetMeasuredRpm(void);
+
+#endif /* INC_MOTOR_H_ */
@@ -0,0 +1,104 @@
+/*
+ * profile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_PROFILE_H_
+#define INC_PROFILE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "stm32f4xx_hal.h"
+
+/* Profiling is only built in the Debug configuration, every hook compiles out in Release */
+#ifdef DEBUG
+#define PROFILE_ENABLED 1
+#else
+#define PROFILE_ENABLED 0
+#endif
+
+typedef enum
+{
+    PROFILE_ZONE_UART_ISR,
+    PROFILE_ZONE_PARSE_RX,
+    PROFILE_ZONE_CONVERT_SAMPLE,
+    PROFILE_ZONE_FILL_AREA,
+    PROFILE_ZONE_TOUCH_POLL,
+    PROFILE_ZONE_MAX
+} profile_zone_e;
+
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t count;
+} profile_stats_t;
+
+#if PROFILE_ENABLED
+
+/**
+ * @brief Start measuring a zone. Must be paired with `PROFILE_END` in the same scope.
+ * @param zone Zone identifier (`profile_zone_e`).
+ */
+#define PROFILE_BEGIN(zone) uint32_t profile_start_##zone = DWT->CYCCNT
+
+/**
+ * @brief Stop measuring a zone and record the elapsed cycles.
+ * @param zone Zone identifier (`profile_zone_e`).
+ */
+#define PROFILE_END(zone) PROFILE_Record((zone), DWT->CYCCNT - profile_start_##zone)
+
+/**
+ * @brief Enable the DWT cycle counter and reset all statistics.
+ */
+void PROFILE_Init(void);
+
+/**
+ * @brief Add a measurement to a zone.
+ * @param zone Zone identifier.
+ * @param cycles Number of CPU cycles spent in the zone.
+ */
+void PROFILE_Record(profile_zone_e zone, uint32_t cycles);
+
+/**
+ * @brief Account one iteration of the main loop for the CPU load estimate.
+ *
+ * Must be called once per main loop iteration. The shortest iteration observed is considered as an idle
+ * iteration, so the CPU load is estimated as the part of the elapsed time not spent in idle iterations.
+ */
+void PROFILE_LoopTick(void);
+
+/**
+ * @brief Get a consistent copy of the statistics of a zone.
+ * @param zone Zone identifier.
+ * @param stats User buffer where the statistics will be stored.
+ * @param reset Reset the zone statistics after reading them.
+ */
+void PROFILE_GetStats(profile_zone_e zone, profile_stats_t *stats, bool reset);
+
+/**
+ * @brief Get the last CPU load estimate.
+ * @return CPU load in percent (0-100).
+ */
+uint8_t PROFILE_GetCpuLoad(void);
+
+/**
+ * @brief Get the display name of a zone.
+ * @param zone Zone identifier.
+ * @return Null-terminated zone name.
+ */
+const char* PROFILE_GetZoneName(profile_zone_e zone);
+
+#else
+
+#define PROFILE_BEGIN(zone)
+#define PROFILE_END(zone)
+#define PROFILE_Init()
+#define PROFILE_LoopTick()
+
+#endif /* PROFILE_ENABLED */
+
+#endif /* INC_PROFILE_H_ */
@@ -0,0 +1,87 @@
+/*
+ * record.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_RECORD_H_
+#define INC_RECORD_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define RECORD_BUFFER_SIZE 4096 // Last 0.4 s of express scan at 4000 samples/s, 0.12 s at 16000 samples/s
+#define RECORD_ENTRY_HEADER_SIZE 6
+#define RECORD_MAGIC 0x43455252 // "RREC"
+#define RECORD_VERSION 1
+
+/* Header of a dump, followed by `length` bytes of entries */
+typedef struct __attribute__((packed))
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entries;
+    uint32_t length;
+    uint32_t cycles_per_second; // Unit of the entry timestamps
+    uint32_t overwritten; // Entries lost since the previous dump because the ring was full
+} record_header_t;
+
+typedef struct
+{
+    uint16_t entries; // Entries in the ring
+    uint16_t used; // Bytes used in the ring
+    uint32_t span; // DWT cycles between the oldest and the newest entry, the time covered by the ring
+    uint32_t overwritten;
+    uint32_t dumps;
+} record_stats_t;
+
+/**
+ * @brief Add bytes received from the lidar to the ring, must be called from `RPLIDAR_OnRawData`.
+ * @param data Received bytes.
+ * @param length Number of bytes.
+ *
+ * The bytes are stored as one entry stamped with the DWT cycle counter. The oldest entries are overwritten when
+ * the ring is full.
+ */
+void RECORD_AddData(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Freeze the ring and save it to flash, then restart recording from an empty ring.
+ * @return True if the dump was written.
+ *
+ * The flash is programmed synchronously, a sector erase may stall the CPU if the store has to be compacted.
+ * The previous dump is replaced.
+ *
+ * Dump format (little endian), as saved and as sent by `RECORD_Send`:
+ * - `record_header_t`
+ * - entries, from the oldest to the newest: reception time in DWT cycles (32 bits), length (16 bits), then the
+ *   raw UART bytes
+ */
+bool RECORD_Dump(void);
+
+/**
+ * @brief Start sending the saved dump to the host link.
+ * @return True if a dump is saved and the link is not used by a previous send.
+ */
+bool RECORD_Send(void);
+
+/**
+ * @brief Send the next part of the dump once the link is idle, must be called periodically from the main loop.
+ *
+ * The parts are sent straight from the flash.
+ */
+void RECORD_Update(void);
+
+/**
+ * @brief Get the usage of the ring.
+ * @param stats User buffer where the statistics will be stored.
+ *
+ * The ring holds a fixed number of bytes, the time it covers depends on the data rate of the scan mode in use. It
+ * keeps the last fraction of a second before the dump, not several seconds: the RAM left is a few KB, and
+ * streaming the bytes to the flash store would erase a 128 KB sector every 3 s at full line rate, wearing it out
+ * within hours. A glitch is caught by dumping right after it.
+ */
+void RECORD_GetStats(record_stats_t *stats);
+
+#endif /* INC_RECORD_H_ */
@@ -0,0 +1,66 @@
+/*
+ * room.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_ROOM_H_
+#define INC_ROOM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sweep.h"
+
+#define ROOM_WALLS_MAX 8
+
+typedef struct
+{
+    // Polygon edge in mm from the sensor, same orientation as the map (x to the right, y downward)
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+    uint16_t length; // mm
+} room_wall_t;
+
+typedef struct
+{
+    uint32_t index; // Sequence number of the estimate
+    uint8_t wall_count;
+    room_wall_t walls[ROOM_WALLS_MAX]; // Edges of the room polygon, ordered around the sensor
+    uint16_t width; // Size along the longest wall in mm
+    uint16_t depth; // Size across the longest wall in mm
+    uint32_t area; // Floor area in cm²
+} room_t;
+
+/**
+ * @brief Drop the accumulated samples and the last estimate.
+ */
+void ROOM_Reset(void);
+
+/**
+ * @brief Accumulate the samples of a sweep.
+ * @param sweep Completed sweep.
+ *
+ * The latest sample of each angle is kept, so the room is estimated on the accumulated revolutions.
+ */
+void ROOM_AddSweep(const sweep_frame_t *sweep);
+
+/**
+ * @brief Run the estimation for a bounded time, must be called periodically from the main loop.
+ * @param budget_us Maximum processing time of the call in microseconds.
+ * @return True if a new estimate has been published.
+ *
+ * Dominant walls are found one after the other by RANSAC over the accumulated samples, then intersected
+ * into the room polygon. The work is split over as many calls as needed to stay within the budget.
+ */
+bool ROOM_Update(uint32_t budget_us);
+
+/**
+ * @brief Get the last room estimate.
+ * @return Last estimate or NULL if none.
+ */
+const room_t* ROOM_Get(void);
+
+#endif /* INC_ROOM_H_ */
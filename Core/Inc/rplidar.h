@@ -61,6 +61,28 @@ typedef struct __attribute__((packed))
     uint16_t distance[40];
 } rplidar_dense_measurements_t;
 
+#define RPLIDAR_SCAN_MODE_MAX 8
+#define RPLIDAR_SCAN_MODE_NAME_SIZE 24
+
+typedef struct
+{
+    uint16_t id;
+    uint32_t us_per_sample; // Q8 fixed point, divide by 256.0 to get microseconds
+    uint32_t max_distance; // Q8 fixed point, divide by 256.0 to get meters
+    uint8_t answer_type;
+    char name[RPLIDAR_SCAN_MODE_NAME_SIZE];
+} rplidar_scan_mode_t;
+
+typedef struct
+{
+    uint32_t rx_bytes;
+    uint32_t measurements;
+    uint32_t revolutions;
+    uint32_t revolution_tick; // HAL tick of the last revolution start
+    uint32_t parse_errors;
+    uint32_t capsule_errors; // Capsules dropped on bad sync or checksum
+} rplidar_stats_t;
+
 /**
  * @brief Initialize communication with the RPLIDAR device.
  * @param huart Pointer to the UART handle.
@@ -101,6 +123,64 @@ bool RPLIDAR_StartScan(rplidar_measurement_t measurement[], uint32_t count, uint
  */
 bool RPLIDAR_StartScanExpress(rplidar_dense_measurements_t *measurements, uint32_t count, uint32_t timeout);
 
+/**
+ * @brief Discover the scan modes supported by the device and select the fastest one.
+ * @return True if at least one supported scan mode has been found, false otherwise.
+ *
+ * This function queries, in blocking mode, the number of scan modes then the name, sample duration, maximum
+ * distance and answer type of each of them. The mode with the shortest sample duration among the answer types
+ * handled by the parser is selected. The result is cached, subsequent calls return immediately.
+ */
+bool RPLIDAR_DiscoverScanModes(void);
+
+/**
+ * @brief Get the scan modes found by `RPLIDAR_DiscoverScanModes`.
+ * @param modes Pointer set to the cached scan modes array.
+ * @return Number of scan modes in the array.
+ */
+uint8_t RPLIDAR_GetScanModes(const rplidar_scan_mode_t **modes);
+
+/**
+ * @brief Get the scan mode selected by `RPLIDAR_DiscoverScanModes`.
+ * @return Selected scan mode or NULL if no mode has been discovered.
+ */
+const rplidar_scan_mode_t* RPLIDAR_GetSelectedScanMode(void);
+
+/**
+ * @brief Start scanning in non-blocking mode with the selected scan mode.
+ * @return True if scanning has started.
+ *
+ * Falls back to legacy scan if no mode has been discovered. Depending on the mode answer type, either the
+ * `RPLIDAR_OnSingleMeasurement` or the `RPLIDAR_OnDenseMeasurements` callback will be called.
+ */
+bool RPLIDAR_StartSelectedScan(void);
+
+/**
+ * @brief Get the reception time of the measurement being delivered.
+ * @return DWT cycle counter value at the reception of the last byte of the measurement.
+ *
+ * Only valid from the measurement callbacks. The time is interpolated from the byte position in the DMA batch
+ * and the baud rate, the batch itself being stamped when the receive event is handled.
+ */
+uint32_t RPLIDAR_GetMeasurementTimestamp(void);
+
+/**
+ * @brief Convert a dense capsule into legacy measurements.
+ * @param capsule Dense capsule to decode.
+ * @param next Capsule received right after, used to interpolate the angle of each sample.
+ * @param measurements User buffer of at least 40 measurements where the samples will be stored.
+ * @param capsule_timestamp Reception time of the capsule (see `RPLIDAR_GetMeasurementTimestamp`).
+ * @param next_timestamp Reception time of the next capsule.
+ * @param timestamps Optional user buffer of at least 40 entries where each sample time will be stored.
+ * @return Number of measurements decoded.
+ *
+ * Distances are converted to the legacy Q2 format and a constant quality is applied as dense answers do not
+ * carry any quality information.
+ */
+uint8_t RPLIDAR_DecodeDenseCapsule(const rplidar_dense_measurements_t *capsule,
+                                   const rplidar_dense_measurements_t *next, rplidar_measurement_t measurements[],
+                                   uint32_t capsule_timestamp, uint32_t next_timestamp, uint32_t timestamps[]);
+
 /**
  * @brief Stop scanning.
  * @return True if scanning is stopped successfully, false otherwise.
@@ -120,9 +200,10 @@ bool RPLIDAR_Reset(void);
 /**
  * @brief Set the motor speed.
  * @param rpm Real-time motor speed.
- * @return True if the command is successful, false otherwise.
+ * @return True if the command is sent, false otherwise or if the previous one is still being sent.
  *
- * This function set the speed of the RPLIDAR motor.
+ * This function set the speed of the RPLIDAR motor. It can be called while scanning, the receive path is
+ * not interrupted.
  */
 bool RPLIDAR_SetMotorSpeed(uint16_t rpm);
 
@@ -179,13 +260,35 @@ bool RPLIDAR_RequestSampleRate(rplidar_samplerate_t *samplerate, uint32_t timeou
  * return true if request has been sent.
  *
  * If a user buffer is provided, the function will return after the response has been received or
- * after the given timeout.
+ * after the given timeout. The user must set `config->payload` to a buffer of `config->payload_size` bytes,
+ * the answer payload is truncated to this capacity and `config->payload_size` is updated with the copied size.
  * If a NULL pointer is provided, the function will return immediately and the `RPLIDAR_OnConfiguration`
  * callback will be called with the response.
  */
 bool RPLIDAR_RequestConfiguration(uint32_t type, uint8_t *payload, uint16_t payload_size,
                                   rplidar_configuration_t *config, uint32_t timeout);
 
+/**
+ * @brief Get the receive path counters.
+ * @param stats User buffer where the counters will be stored.
+ *
+ * Counters are cumulative since boot and wrap around, compute rates from the difference between two calls.
+ */
+void RPLIDAR_GetStats(rplidar_stats_t *stats);
+
+/**
+ * @brief Get the DMA reception ring.
+ * @param size Pointer where the size of the ring in bytes will be stored.
+ * @return Start of the ring, the bytes given to `RPLIDAR_OnRawData` point inside it.
+ */
+const uint8_t* RPLIDAR_GetRxBuffer(uint16_t *size);
+
+/**
+ * @brief Get the position where the DMA writes the next received byte, read from its live counter.
+ * @return Index in the reception ring, ahead of the bytes given to `RPLIDAR_OnRawData` until the next event.
+ */
+uint16_t RPLIDAR_GetRxHead(void);
+
 /**
  * @brief Callback called when a legacy measurement is received.
  * @param measurement Measurement made by the RPLIDAR.
@@ -198,10 +301,22 @@ void RPLIDAR_OnSingleMeasurement(rplidar_measurement_t *measurement);
  * @brief Callback called when a dense measurement is received.
  * @param measurement Measurement made by the RPLIDAR.
  *
+ * Only capsules with valid sync values and checksum are delivered, the others are counted in
+ * `rplidar_stats_t.capsule_errors` and dropped.
+ *
  * Measurement distance field should be divided by 4.0 to get the real distance in mm.
  * Measurement angle field should be divided by 64.0 to get the real angle in °.
  */
 void RPLIDAR_OnDenseMeasurements(rplidar_dense_measurements_t *measurement);
+/**
+ * @brief Callback called from the UART interrupt with the bytes just received, before they are parsed.
+ * @param data Received bytes, in the DMA reception ring.
+ * @param length Number of bytes.
+ *
+ * It is called twice when the batch wraps around the end of the ring. The bytes stay valid until the DMA has
+ * written a full ring of new bytes over them.
+ */
+void RPLIDAR_OnRawData(const uint8_t *data, uint16_t length);
 void RPLIDAR_OnDeviceInfo(rplidar_info_t *info);
 void RPLIDAR_OnHealth(rplidar_health_t *health);
 void RPLIDAR_OnSampleRate(rplidar_samplerate_t *samplerate);
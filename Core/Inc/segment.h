@@ -0,0 +1,46 @@
+/*
+ * segment.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_SEGMENT_H_
+#define INC_SEGMENT_H_
+
+#include <stdint.h>
+#include "sweep.h"
+
+#define SEGMENT_MAX 48
+
+typedef struct
+{
+    // Endpoints in mm from the sensor, same orientation as the map (x to the right, y downward)
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+    uint16_t error; // RMS distance between the samples and the fitted line in mm
+    uint16_t count; // Number of samples supporting the segment
+    uint8_t quality; // Average quality of the samples (0-63)
+} segment_t;
+
+/**
+ * @brief Extract the wall segments of a sweep.
+ * @param sweep Completed sweep, samples ordered by angle.
+ * @return Number of segments extracted.
+ *
+ * The sweep is cut where consecutive samples are too far apart, each part is recursively split at its farthest
+ * sample from the chord (split-and-merge), then a line is fitted on each part by least squares and collinear
+ * neighbours are merged.
+ */
+uint8_t SEGMENT_Extract(const sweep_frame_t *sweep);
+
+/**
+ * @brief Get the segments of the last extracted sweep.
+ * @param count Pointer where the number of segments will be stored.
+ * @return Segments array, valid until the next extraction.
+ */
+const segment_t* SEGMENT_GetSegments(uint8_t *count);
+
+#endif /* INC_SEGMENT_H_ */
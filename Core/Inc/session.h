@@ -0,0 +1,111 @@
+/*
+ * session.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_SESSION_H_
+#define INC_SESSION_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SESSION_CHUNK_SIZE 512 // Largest record written per step
+
+typedef struct
+{
+    uint8_t scale_mode;
+    uint8_t quality_min;
+    uint8_t persistence_mode;
+    uint8_t render_mode;
+    uint16_t scale_distance; // mm at the edge of the map
+    uint16_t point_count; // Points offered to `SESSION_OnSavePoint`, unused ones included, less if the save stopped
+} session_info_t;
+
+typedef struct
+{
+    uint16_t x; // Screen position, (0, 0) is an unused point
+    uint16_t y;
+    uint8_t quality;
+} session_point_t;
+
+typedef enum
+{
+    SESSION_STATE_IDLE,
+    SESSION_STATE_RESERVE,
+    SESSION_STATE_TILES,
+    SESSION_STATE_POINTS,
+    SESSION_STATE_COMMIT,
+    SESSION_STATE_CLEANUP,
+    SESSION_STATE_MAX
+} session_state_e;
+
+/**
+ * @brief Start saving the map in the background.
+ * @param info Map settings, stored in the session header.
+ * @return True if the save is started, false if one is already running.
+ *
+ * The points are requested one by one through `SESSION_OnSavePoint` while the save progresses, the previous
+ * session stays valid until the new one is complete.
+ */
+bool SESSION_Save(const session_info_t *info);
+
+/**
+ * @brief Run the next step of the save, must be called periodically from the main loop.
+ * @return True when the save has just ended, see `SESSION_IsSaved` for the result.
+ *
+ * Each step programs at most one record of `SESSION_CHUNK_SIZE` bytes so that samples keep being processed.
+ * Only the first step may erase a sector if the store has to be compacted, see `SESSION_Reserve`.
+ */
+bool SESSION_Update(void);
+
+/**
+ * @brief Make room in the store for a save, compacting it now if needed.
+ * @param point_count Points of the save.
+ * @return True if a save of this size will not have to compact the store.
+ *
+ * Meant to be called while the scan is stopped, so that the erase of the next save does not interrupt a scan.
+ */
+bool SESSION_Reserve(uint16_t point_count);
+
+/**
+ * @brief Get the current step of the save.
+ * @return `SESSION_STATE_IDLE` if no save is running.
+ */
+session_state_e SESSION_GetState(void);
+
+/**
+ * @brief Check the result of the last save.
+ * @return True if the last save was complete.
+ */
+bool SESSION_IsSaved(void);
+
+/**
+ * @brief Read the header of the saved session.
+ * @param info User buffer where the map settings will be stored.
+ * @return True if a session is saved.
+ */
+bool SESSION_GetInfo(session_info_t *info);
+
+/**
+ * @brief Read the points of the saved session, each one is given to `SESSION_OnLoadPoint`.
+ * @return True if all points were read.
+ */
+bool SESSION_Load(void);
+
+/**
+ * @brief Callback called to get the points to save, from the oldest to the newest.
+ * @param index Point index, from 0 to `point_count` - 1.
+ * @param point User buffer where the point will be stored.
+ * @return False if the point is not available anymore, the save stops there and keeps the previous points.
+ */
+bool SESSION_OnSavePoint(uint16_t index, session_point_t *point);
+
+/**
+ * @brief Callback called for each point of the saved session, from the oldest to the newest.
+ * @param point Saved point.
+ */
+void SESSION_OnLoadPoint(const session_point_t *point);
+
+#endif /* INC_SESSION_H_ */
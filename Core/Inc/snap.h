@@ -0,0 +1,44 @@
+/*
+ * snap.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_SNAP_H_
+#define INC_SNAP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SNAP_POINTS_MAX 1024
+
+typedef struct
+{
+    int16_t x; // mm from the sensor, same orientation as the map (x to the right, y downward)
+    int16_t y;
+} snap_point_t;
+
+/**
+ * @brief Remove all points from the index.
+ */
+void SNAP_Reset(void);
+
+/**
+ * @brief Add a sample position to the index, replacing the oldest one when full.
+ * @param point Sample position in mm.
+ */
+void SNAP_AddPoint(const snap_point_t *point);
+
+/**
+ * @brief Find the indexed point nearest to a position.
+ * @param target Position in mm.
+ * @param radius Search radius in mm.
+ * @param nearest Pointer where the nearest point will be stored.
+ * @return True if a point was found within the radius.
+ *
+ * Points are hashed on a uniform grid, so only the cells overlapping the search radius are visited.
+ */
+bool SNAP_FindNearest(const snap_point_t *target, uint16_t radius, snap_point_t *nearest);
+
+#endif /* INC_SNAP_H_ */
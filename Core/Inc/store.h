@@ -0,0 +1,99 @@
+/*
+ * store.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_STORE_H_
+#define INC_STORE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define STORE_ID_ALL 0xFFFFFFFF // Delete every record of a type
+#define STORE_RECORD_MAX 4096 // Largest payload in bytes
+
+typedef enum
+{
+    STORE_TYPE_TILE = 1, STORE_TYPE_SESSION = 2, STORE_TYPE_RECORD = 3
+} store_type_e;
+
+typedef struct
+{
+    uint32_t records; // Records in the active sector, including superseded ones
+    uint32_t used; // Bytes used in the active sector
+    uint32_t size; // Size of a sector in bytes
+    uint32_t compactions;
+    uint32_t errors;
+} store_stats_t;
+
+/**
+ * @brief Mount the record log from the two storage sectors, formatting them if none is valid.
+ * @return True if the store is usable.
+ *
+ * Records are appended to the active sector, a new version of a record supersedes the previous ones. When the
+ * active sector is full, the live records are copied to the other sector which becomes the active one.
+ */
+bool STORE_Init(void);
+
+/**
+ * @brief Append a record to the log.
+ * @param type Record type.
+ * @param id Record identifier, unique per type.
+ * @param data Payload to store.
+ * @param length Payload size in bytes, up to `STORE_RECORD_MAX`.
+ * @return True if the record was written.
+ *
+ * The flash is programmed synchronously. A sector erase stalls the CPU for up to 2 s when a compaction is needed,
+ * it is surrounded by `STORE_OnEraseStart` and `STORE_OnEraseEnd`.
+ */
+bool STORE_Write(uint16_t type, uint32_t id, const void *data, uint16_t length);
+
+/**
+ * @brief Make sure that records can be appended without compacting the log.
+ * @param length Total payload size of the records in bytes.
+ * @param count Number of records.
+ * @return True if the space is available.
+ *
+ * The log is compacted now if needed, so that a sequence of writes does not stall in the middle.
+ */
+bool STORE_Reserve(uint32_t length, uint16_t count);
+
+/**
+ * @brief Delete a record, or all the records of a type.
+ * @param type Record type.
+ * @param id Record identifier, or `STORE_ID_ALL`.
+ * @return True if the deletion was written.
+ */
+bool STORE_Delete(uint16_t type, uint32_t id);
+
+/**
+ * @brief Find the latest version of a record.
+ * @param type Record type.
+ * @param id Record identifier.
+ * @param length Pointer where the payload size will be stored.
+ * @return Payload in the memory mapped flash, NULL if the record does not exist.
+ */
+const void* STORE_Find(uint16_t type, uint32_t id, uint16_t *length);
+
+/**
+ * @brief Get the usage of the active sector.
+ * @param stats User buffer where the statistics will be stored.
+ */
+void STORE_GetStats(store_stats_t *stats);
+
+/**
+ * @brief Callback called before a sector erase.
+ *
+ * Code is fetched from the same flash bank, so the CPU and the interrupts are stalled until the erase ends. Data
+ * sources received by DMA must be stopped here.
+ */
+void STORE_OnEraseStart(void);
+
+/**
+ * @brief Callback called after a sector erase, successful or not.
+ */
+void STORE_OnEraseEnd(void);
+
+#endif /* INC_STORE_H_ */
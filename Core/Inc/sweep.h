@@ -0,0 +1,67 @@
+/*
+ * sweep.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_SWEEP_H_
+#define INC_SWEEP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "rplidar.h"
+
+#define SWEEP_ANGLE_BIN_SHIFT 5 // Q6 angle to bin, 0.5 degree bins
+#define SWEEP_SAMPLES_MAX 720 // One sample per angle bin
+
+typedef struct
+{
+    uint32_t timestamp; // DWT cycle counter value when the sample was measured
+    uint16_t angle; // Q6, divide by 64.0 to get degrees
+    uint16_t distance; // Q2, divide by 4.0 to get mm
+    uint8_t quality;
+} sweep_sample_t;
+
+typedef struct
+{
+    uint32_t index; // Sequence number of the sweep
+    uint32_t start_timestamp;
+    uint32_t end_timestamp;
+    uint16_t count;
+    uint16_t decimated; // Samples merged with another one of the same angle bin
+    bool truncated; // Samples were dropped as the frame was full, only when the angles are not increasing
+    sweep_sample_t samples[SWEEP_SAMPLES_MAX];
+} sweep_frame_t;
+
+/**
+ * @brief Drop the sweep being assembled and the last completed one.
+ */
+void SWEEP_Reset(void);
+
+/**
+ * @brief Append a sample to the sweep being assembled.
+ * @param measurement Measurement to append.
+ * @param timestamp Time of the measurement (DWT cycles).
+ * @return True if the measurement started a new revolution and the previous sweep has been completed.
+ *
+ * Samples are kept in reception order, so they are ordered by angle within a sweep. Fast scan modes measure more
+ * samples per revolution than the frame holds, only the best sample of each angle bin is kept so the whole
+ * revolution is covered.
+ */
+bool SWEEP_AddSample(const rplidar_measurement_t *measurement, uint32_t timestamp);
+
+/**
+ * @brief Get the last completed sweep.
+ * @return Last completed sweep or NULL if none. It stays valid until the next sample is added.
+ */
+const sweep_frame_t* SWEEP_GetFrame(void);
+
+/**
+ * @brief Convert a duration between two timestamps to microseconds.
+ * @param cycles Duration in DWT cycles.
+ * @return Duration in microseconds.
+ */
+uint32_t SWEEP_CyclesToUs(uint32_t cycles);
+
+#endif /* INC_SWEEP_H_ */
@@ -0,0 +1,102 @@
+/*
+ * tile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#ifndef INC_TILE_H_
+#define INC_TILE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TILE_SIZE 32 // Cells per side, the tiles are centred on the origin
+#define TILE_SLOTS_LEVEL 6 // Tiles kept in RAM per level, the samples seen from one place span 2x2 tiles at most
+#define TILE_SPARE_SLOTS 2 // Slots per level kept clean for the tiles entered during a revolution
+#define TILE_HITS_MAX 15
+#define TILE_PENDING_MAX 128 // Hits kept while their tile is paged in, when no spare slot is left
+
+typedef enum
+{
+    TILE_LEVEL_FINE, TILE_LEVEL_COARSE, TILE_LEVEL_MAX
+} tile_level_e;
+
+#define TILE_SLOTS (TILE_SLOTS_LEVEL * TILE_LEVEL_MAX) // Tiles kept in RAM
+
+typedef struct
+{
+    uint32_t loaded; // Tiles read back from the flash
+    uint32_t written; // Tiles compressed to the flash
+    uint32_t failed; // Tiles that could not be written, their new hits are lost
+    uint32_t dropped; // Hits lost as too many were waiting for their tile
+    uint8_t pending; // Hits waiting for their tile
+    uint8_t resident; // Tiles currently in RAM
+} tile_stats_t;
+
+/**
+ * @brief Drop the tiles in RAM and delete the stored ones.
+ */
+void TILE_Reset(void);
+
+/**
+ * @brief Add a sample to the occupancy map.
+ * @param x Sample position in mm in the map frame.
+ * @param y Sample position in mm in the map frame.
+ * @param distance Distance from the sensor in mm.
+ *
+ * The close samples are counted in both levels, only the coarse level covers the full range. The flash is never
+ * accessed here: a tile missing from RAM takes a spare slot and starts empty, its stored hits are added by
+ * `TILE_Update`. Without a spare slot, the hit waits in a small queue until `TILE_Update` pages the tile in.
+ */
+void TILE_AddPoint(int32_t x, int32_t y, uint16_t distance);
+
+/**
+ * @brief Read back the tiles entered during the revolution and page in the ones waited by the queued hits.
+ *
+ * Must be called from the main loop, once per revolution. The least recently used tiles are evicted to make room,
+ * then written to the flash if they were modified so that `TILE_SPARE_SLOTS` slots per level are clean for the
+ * next revolution. The tiles in use stay in RAM, so the flash is only written when the sensor moves to other
+ * tiles.
+ */
+void TILE_Update(void);
+
+/**
+ * @brief Get the number of samples seen in the cells along a row of the map.
+ * @param level Resolution level.
+ * @param x Position of the first cell in mm in the map frame.
+ * @param y Position of the row in mm in the map frame.
+ * @param step Distance in mm between two positions of the row.
+ * @param count Number of positions.
+ * @param hits User buffer of `count` bytes, hits in the cell of each position saturated to `TILE_HITS_MAX`.
+ *
+ * Tiles missing from RAM are read from the flash without being paged in, they are looked up once per tile crossed
+ * by the row.
+ */
+void TILE_GetRow(tile_level_e level, int32_t x, int32_t y, int32_t step, uint16_t count, uint8_t *hits);
+
+/**
+ * @brief Get the size of the cells of a level.
+ * @param level Resolution level.
+ * @return Cell side in mm.
+ */
+uint16_t TILE_GetCellSize(tile_level_e level);
+
+/**
+ * @brief Write the modified tiles to the flash, they are kept in RAM.
+ */
+void TILE_Flush(void);
+
+/**
+ * @brief Write the next modified tile to the flash, it is kept in RAM.
+ * @return True if a tile was written, false if none is left.
+ */
+bool TILE_FlushNext(void);
+
+/**
+ * @brief Get the paging statistics.
+ * @param stats User buffer where the statistics will be stored.
+ */
+void TILE_GetStats(tile_stats_t *stats);
+
+#endif /* INC_TILE_H_ */
@@ -1,10 +1,16 @@
 #include <stdbool.h>
 #include <string.h>
+#include <stdlib.h>
 
 #include "ILI9488.h"
+#include "profile.h"
 #include "stm32f4xx_hal.h"
 
 #define BUFFER_SIZE 2048
+#define FILL_CHUNK_SIZE ((BUFFER_SIZE / 3) * 3) // Whole pixels only
+#define FILL_PATTERN_SIZE 12 // 4 pixels are 3 words
+#define FILL_CIRCULAR_MIN (8 * FILL_CHUNK_SIZE) // Smaller fills are sent chunk by chunk
+#define FILL_CIRCULAR_PATTERN_MIN (FILL_CHUNK_SIZE / 4) // Limits the DMA interrupts per fill
 
 #define ILI9488_DMA_CUTOFF 	20
 
@@ -32,14 +38,23 @@ int16_t ili9488_width = 0;
 int16_t ili9488_height = 0;
 
 static ILI9488_Config_t config;
-static uint8_t dispBuffer1[BUFFER_SIZE];
-static uint8_t dispBuffer2[BUFFER_SIZE];
+static uint8_t dispBuffer1[BUFFER_SIZE] __attribute__((aligned(4)));
+static uint8_t dispBuffer2[BUFFER_SIZE] __attribute__((aligned(4)));
 static uint8_t *dispBuffer = dispBuffer1;
+static ILI9488_Color_t dispFillColor[2]; // Solid color held by each buffer
+static uint16_t dispFillSize[2]; // Bytes of that color, 0 if the buffer holds other data
+static volatile uint16_t dispCircularRemaining = 0; // Repetitions left in the circular fill
+static uint32_t bytesSent = 0;
 
 static void _Transmit(const uint8_t *data, uint16_t dataSize, bool command);
+static void _TransmitCircular(const uint8_t *data, uint16_t dataSize, uint16_t count);
 static void _WriteCommand(uint8_t cmd);
 static void _WriteData(const uint8_t *data, size_t size);
 static void ILI9488_Reset();
+static ILI9488_Color_t _ToRGB666(uint16_t color);
+static uint8_t _GetBufferIndex(void);
+static void _FillPattern(uint8_t *buf, const ILI9488_Color_t *color, uint16_t size);
+static uint16_t _GetCircularRows(uint16_t w, uint16_t h);
 
 void ILI9488_Init(ILI9488_Config_t conf, ILI9488_Orientation_e orientation)
 {
@@ -118,20 +133,32 @@ void ILI9488_SetAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2,
 
 void ILI9488_FillArea(uint16_t x1, uint16_t y1, uint16_t w, uint16_t h,
 		uint16_t color)
+{
+	ILI9488_Color_t rgb = _ToRGB666(color);
+
+	ILI9488_FillAreaRGB666(x1, y1, w, h, &rgb);
+}
+
+/************************
+ * @brief	fill an area with a color already in the display format,
+ * 			no conversion from RGB565 is done
+ ************************/
+void ILI9488_FillAreaRGB666(uint16_t x1, uint16_t y1, uint16_t w, uint16_t h,
+		const ILI9488_Color_t *color)
 {
 	uint16_t times = 0;
 	uint32_t totalDataSize = 0;
 	uint32_t dataSize = 0;
 	uint16_t x2 = 0;
 	uint16_t y2 = 0;
-	uint8_t red = (color & 0xF800) >> 8;
-	uint8_t green = (color & 0x07E0) >> 3;
-	uint8_t blue = (color & 0x001F) << 3;
-	uint8_t *buf = dispBuffer;
+	uint16_t circularRows = 0;
+	uint8_t idx = _GetBufferIndex();
 
 	if ((x1 >= ili9488_width) || (y1 >= ili9488_height) || (w == 0) || (h == 0))
 		return;
 
+	PROFILE_BEGIN(PROFILE_ZONE_FILL_AREA);
+
 	x2 = x1 + w - 1;
 	if (x2 > ili9488_width)
 	{
@@ -146,34 +173,73 @@ void ILI9488_FillArea(uint16_t x1, uint16_t y1, uint16_t w, uint16_t h,
 
 	totalDataSize = (((y2 - y1 + 1) * (x2 - x1 + 1)) * 3);
 	dataSize = (
-			totalDataSize < (BUFFER_SIZE - 3) ?
-					totalDataSize : (BUFFER_SIZE - 3));
+			totalDataSize < FILL_CHUNK_SIZE ?
+					totalDataSize : FILL_CHUNK_SIZE);
+	if (totalDataSize >= FILL_CIRCULAR_MIN)
+	{
+		// The pattern is whole rows of the area so that it is repeated an exact number of times
+		circularRows = _GetCircularRows(x2 - x1 + 1, y2 - y1 + 1);
+		if (circularRows > 0)
+		{
+			dataSize = circularRows * (x2 - x1 + 1) * 3;
+		}
+	}
 
-	while ((buf - dispBuffer) <= dataSize)
+	// The grid and the UI reuse a few colors, the buffer often holds the pattern already
+	if ((dispFillSize[idx] < dataSize)
+			|| (memcmp(&dispFillColor[idx], color, sizeof(ILI9488_Color_t)) != 0))
 	{
-		*(buf++) = red;
-		*(buf++) = green;
-		*(buf++) = blue;
+		_FillPattern(dispBuffer, color, dataSize);
+		dispFillColor[idx] = *color;
+		dispFillSize[idx] = dataSize;
 	}
-	dataSize = buf - dispBuffer;
 
 	ILI9488_SetAddressWindow(x1, y1, x2, y2);
 
 	times = (totalDataSize / dataSize);
-	for (uint16_t i = 0; i < times; i++)
+	if (circularRows > 0)
 	{
-		_WriteData(dispBuffer, dataSize);
+		// Returns at once, the next transfer waits for the end of this one
+		_TransmitCircular(dispBuffer, dataSize, times);
+	}
+	else
+	{
+		for (uint16_t i = 0; i < times; i++)
+		{
+			_WriteData(dispBuffer, dataSize);
+		}
+		if (totalDataSize > (times * dataSize))
+		{
+			_WriteData(dispBuffer, (totalDataSize - (times * dataSize)));
+		}
 	}
-	_WriteData(dispBuffer, (totalDataSize - (times * dataSize)));
 
 	dispBuffer = (dispBuffer == dispBuffer1 ? dispBuffer2 : dispBuffer1);
+
+	PROFILE_END(PROFILE_ZONE_FILL_AREA);
 }
 
 void ILI9488_Pixel(uint16_t x, uint16_t y, uint16_t color)
+{
+	ILI9488_Color_t rgb = _ToRGB666(color);
+
+	ILI9488_PixelRGB666(x, y, &rgb);
+}
+
+/************************
+ * @brief	draw a pixel, its 3 bytes are sent as they are without
+ * 			going through the display buffers
+ ************************/
+void ILI9488_PixelRGB666(uint16_t x, uint16_t y, const ILI9488_Color_t *color)
 {
 	if ((x >= ili9488_width) || (y >= ili9488_height))
 		return;
-	ILI9488_FillArea(x, y, 1, 1, color);
+
+	PROFILE_BEGIN(PROFILE_ZONE_FILL_AREA);
+	ILI9488_SetAddressWindow(x, y, x, y);
+	// Below the DMA cutoff, the bytes are sent before returning
+	_WriteData((const uint8_t*) color, sizeof(ILI9488_Color_t));
+	PROFILE_END(PROFILE_ZONE_FILL_AREA);
 }
 
 void ILI9488_DrawBorder(int16_t x, int16_t y, int16_t w, int16_t h, int16_t t,
@@ -261,6 +327,54 @@ void ILI9488_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 	}
 }
 
+/***********************
+ * @brief	draw a line between two points
+ * 			(each horizontal or vertical run of pixels is sent as a
+ * 			single area, so near axis-aligned lines stay cheap)
+ **********************/
+void ILI9488_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+		uint16_t color)
+{
+	bool steep = abs(y1 - y0) > abs(x1 - x0);
+	int16_t dx, dy, err, ystep, run;
+
+	if (steep)
+	{
+		_swap_int16_t(x0, y0);
+		_swap_int16_t(x1, y1);
+	}
+	if (x0 > x1)
+	{
+		_swap_int16_t(x0, x1);
+		_swap_int16_t(y0, y1);
+	}
+
+	dx = x1 - x0;
+	dy = abs(y1 - y0);
+	err = dx / 2;
+	ystep = (y0 < y1) ? 1 : -1;
+	run = x0;
+
+	for (; x0 <= x1; x0++)
+	{
+		err -= dy;
+		if (err < 0 || x0 == x1)
+		{
+			// End of the run on the current row, send it at once
+			if (steep)
+				ILI9488_FillArea(y0, run, 1, x0 - run + 1, color);
+			else
+				ILI9488_FillArea(run, y0, x0 - run + 1, 1, color);
+			if (err < 0)
+			{
+				y0 += ystep;
+				err += dx;
+			}
+			run = x0 + 1;
+		}
+	}
+}
+
 void ILI9488_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 		const uint8_t *data, uint32_t size)
 {
@@ -268,6 +382,25 @@ void ILI9488_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 	_WriteData(data, size);
 }
 
+/***********************
+ * @brief	decompress an image in the display buffers, each chunk is
+ * 			decoded while the DMA sends the previous one
+ **********************/
+void ILI9488_DrawCompressedImage(uint16_t x, uint16_t y, const image_t *image)
+{
+	image_decoder_t decoder;
+	uint16_t size;
+
+	IMAGE_Start(&decoder, image);
+	ILI9488_SetAddressWindow(x, y, x + image->width - 1, y + image->height - 1);
+	while ((size = IMAGE_Decode(&decoder, dispBuffer, FILL_CHUNK_SIZE)) > 0)
+	{
+		dispFillSize[_GetBufferIndex()] = 0; // The pixels replace the fill pattern
+		_WriteData(dispBuffer, size);
+		dispBuffer = (dispBuffer == dispBuffer1 ? dispBuffer2 : dispBuffer1);
+	}
+}
+
 /***********************
  * @brief	display one character on the display
  * @param 	x,y: top left corner of the character to be printed
@@ -306,6 +439,8 @@ void ILI9488_WChar(uint16_t x, uint16_t y, char ch, sFONT font, uint8_t size,
 	uint8_t Gbak = (bgcolor & 0x07E0) >> 3;
 	uint8_t Bbak = (bgcolor & 0x001F) << 3;
 
+	dispFillSize[_GetBufferIndex()] = 0; // The glyph replaces the fill pattern
+
 	for (i = 0; i < (bytes); i += font.Size)
 	{
 		b = 0;
@@ -434,12 +569,25 @@ void ILI9488_CString(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
 	ILI9488_WString(x, y, str, font, size, color, bgcolor);
 }
 
+/************************
+ * @brief	number of pixel data bytes sent to the display since boot
+ * 			(wraps around, used to compute the SPI throughput)
+ ************************/
+uint32_t ILI9488_GetBytesSent(void)
+{
+	return bytesSent;
+}
+
 static void _Transmit(const uint8_t *data, uint16_t dataSize, bool command)
 {
 
 	while (HAL_SPI_GetState(config.spi) != HAL_SPI_STATE_READY)
 	{
 	};
+	// A stopped circular fill may still be shifting its last byte out
+	while (__HAL_SPI_GET_FLAG(config.spi, SPI_FLAG_BSY))
+	{
+	};
 
 	HAL_GPIO_WritePin(config.dc_port, config.dc_pin,
 			command ? GPIO_PIN_RESET : GPIO_PIN_SET);
@@ -454,6 +602,52 @@ static void _Transmit(const uint8_t *data, uint16_t dataSize, bool command)
 	}
 }
 
+/************************
+ * @brief	send the same buffer count times with the DMA in circular
+ * 			mode, the transfer complete interrupt stops it after the
+ * 			last repetition
+ ************************/
+static void _TransmitCircular(const uint8_t *data, uint16_t dataSize,
+		uint16_t count)
+{
+	DMA_HandleTypeDef *hdma = config.spi->hdmatx;
+
+	while (HAL_SPI_GetState(config.spi) != HAL_SPI_STATE_READY)
+	{
+	};
+	while (__HAL_SPI_GET_FLAG(config.spi, SPI_FLAG_BSY))
+	{
+	};
+
+	HAL_GPIO_WritePin(config.dc_port, config.dc_pin, GPIO_PIN_SET);
+
+	// The stream is disabled, its mode can be changed without a new init
+	hdma->Init.Mode = DMA_CIRCULAR;
+	SET_BIT(hdma->Instance->CR, DMA_SxCR_CIRC);
+	dispCircularRemaining = count;
+	bytesSent += (uint32_t) dataSize * count;
+	HAL_SPI_Transmit_DMA(config.spi, data, dataSize);
+}
+
+/************************
+ * @brief	count the repetitions of the circular fill
+ * 			(the bytes sent before the stream is stopped wrap to the
+ * 			start of the address window, they redraw it in the same
+ * 			color)
+ ************************/
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+	if ((hspi != config.spi) || (dispCircularRemaining == 0))
+		return;
+
+	if (--dispCircularRemaining == 0)
+	{
+		HAL_SPI_DMAStop(hspi);
+		CLEAR_BIT(hspi->hdmatx->Instance->CR, DMA_SxCR_CIRC);
+		hspi->hdmatx->Init.Mode = DMA_NORMAL;
+	}
+}
+
 static void _WriteCommand(uint8_t cmd)
 {
 	_Transmit(&cmd, sizeof(cmd), true);
@@ -461,6 +655,7 @@ static void _WriteCommand(uint8_t cmd)
 
 static void _WriteData(const uint8_t *data, size_t size)
 {
+	bytesSent += size;
 	_Transmit(data, size, false);
 }
 
@@ -472,3 +667,59 @@ static void ILI9488_Reset()
 	HAL_Delay(150);
 }
 
+static ILI9488_Color_t _ToRGB666(uint16_t color)
+{
+	ILI9488_Color_t rgb;
+
+	rgb.red = (color & 0xF800) >> 8;
+	rgb.green = (color & 0x07E0) >> 3;
+	rgb.blue = (color & 0x001F) << 3;
+	return rgb;
+}
+
+static uint8_t _GetBufferIndex(void)
+{
+	return (dispBuffer == dispBuffer1) ? 0 : 1;
+}
+
+/************************
+ * @brief	write the color pattern in a buffer, 32 bits at a time
+ * @param	size: multiple of 3 bytes
+ ************************/
+static void _FillPattern(uint8_t *buf, const ILI9488_Color_t *color, uint16_t size)
+{
+	uint8_t pattern[FILL_PATTERN_SIZE];
+	uint32_t words[FILL_PATTERN_SIZE / 4];
+	uint32_t *dst = (uint32_t*) buf;
+	uint16_t i = 0;
+
+	for (i = 0; i < FILL_PATTERN_SIZE; i += 3)
+	{
+		memcpy(&pattern[i], color, 3);
+	}
+	memcpy(words, pattern, sizeof(words));
+
+	for (i = 0; (i + FILL_PATTERN_SIZE) <= size; i += FILL_PATTERN_SIZE)
+	{
+		*(dst++) = words[0];
+		*(dst++) = words[1];
+		*(dst++) = words[2];
+	}
+	memcpy(&buf[i], pattern, size - i);
+}
+
+/************************
+ * @brief	number of rows repeated by a circular fill, the largest
+ * 			divisor of the height fitting in a display buffer
+ * @return	0 if the pattern would be too small
+ ************************/
+static uint16_t _GetCircularRows(uint16_t w, uint16_t h)
+{
+	uint16_t rows = FILL_CHUNK_SIZE / (w * 3);
+
+	while ((rows > 1) && ((h % rows) != 0))
+		rows--;
+	if ((rows * w * 3) < FILL_CIRCULAR_PATTERN_MIN)
+		return 0;
+	return rows;
+}
@@ -0,0 +1,139 @@
+/*
+ * bridge.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bridge.h"
+#include "rplidar.h"
+#include "link.h"
+
+// Positions in the received byte stream, the ring index is the position modulo the ring size (a power of 2, so
+// that it stays true when the positions wrap around)
+static volatile uint32_t bridge_received = 0;
+static uint32_t bridge_sent = 0;
+static volatile bool bridge_synced = false; // Positions are aligned on the ring from the first received bytes
+static uint16_t bridge_in_flight = 0;
+static volatile bool bridge_enabled = false;
+static uint32_t bridge_bytes = 0;
+static uint32_t bridge_dropped = 0;
+static uint32_t bridge_transfers = 0;
+
+static void _Drop(uint32_t written, uint32_t received, uint16_t ring_size);
+
+void BRIDGE_Enable(bool enable)
+{
+    // Stop accounting before moving the positions, the interrupt must not see them half updated
+    bridge_enabled = false;
+    bridge_synced = false;
+    if (enable)
+    {
+        bridge_bytes = 0;
+        bridge_dropped = 0;
+        bridge_transfers = 0;
+    }
+    // A transfer still in flight is left to complete, its bytes are not counted
+    bridge_in_flight = 0;
+    bridge_enabled = enable;
+}
+
+bool BRIDGE_IsEnabled(void)
+{
+    return bridge_enabled;
+}
+
+void BRIDGE_AddData(const uint8_t *data, uint16_t length)
+{
+    if (!bridge_enabled)
+    {
+        return;
+    }
+
+    if (!bridge_synced)
+    {
+        uint16_t ring_size;
+        uint16_t idx = data - RPLIDAR_GetRxBuffer(&ring_size);
+        bridge_received = idx;
+        bridge_sent = idx;
+        bridge_synced = true;
+    }
+    bridge_received += length;
+}
+
+void BRIDGE_Update(void)
+{
+    uint16_t ring_size;
+    const uint8_t *ring = RPLIDAR_GetRxBuffer(&ring_size);
+
+    if (!bridge_enabled || !bridge_synced || LINK_IsBusy())
+    {
+        return;
+    }
+
+    uint32_t received = bridge_received;
+    // The DMA keeps writing after the last reception event, the overwrites are checked against its live position
+    uint32_t written = received + (RPLIDAR_GetRxHead() + ring_size - received % ring_size) % ring_size;
+    if (bridge_in_flight > 0)
+    {
+        // The DMA may have written over the bytes while they were sent
+        if (written - bridge_sent > ring_size)
+        {
+            bridge_dropped += bridge_in_flight;
+        }
+        else
+        {
+            bridge_bytes += bridge_in_flight;
+            bridge_transfers++;
+        }
+        bridge_sent += bridge_in_flight;
+        bridge_in_flight = 0;
+    }
+
+    if (written - bridge_sent > ring_size)
+    {
+        _Drop(written, received, ring_size);
+    }
+
+    uint32_t pending = received - bridge_sent;
+    if (pending == 0)
+    {
+        return;
+    }
+
+    // Send up to the end of the ring, the rest goes with the next transfer
+    uint16_t idx = bridge_sent % ring_size;
+    uint16_t length = pending < (uint32_t) (ring_size - idx) ? pending : ring_size - idx;
+    if (LINK_Transmit(&ring[idx], length))
+    {
+        bridge_in_flight = length;
+    }
+    else
+    {
+        // No host connected
+        bridge_dropped += pending;
+        bridge_sent = received;
+    }
+}
+
+void BRIDGE_GetStats(bridge_stats_t *stats)
+{
+    stats->bytes = bridge_bytes;
+    stats->dropped = bridge_dropped;
+    stats->transfers = bridge_transfers;
+}
+
+static void _Drop(uint32_t written, uint32_t received, uint16_t ring_size)
+{
+    // Restart half a ring behind the DMA, these bytes stay valid for another half ring
+    uint32_t restart = written - ring_size / 2;
+    if ((int32_t) (restart - received) > 0)
+    {
+        // Not reported yet, wait for the next reception event
+        restart = received;
+    }
+    bridge_dropped += restart - bridge_sent;
+    bridge_sent = restart;
+}
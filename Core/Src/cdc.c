@@ -0,0 +1,830 @@
+/*
+ * cdc.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f4xx_hal.h"
+#include "cdc.h"
+#include "link.h"
+
+#define CDC_VID 0x0483 // STMicroelectronics, the product of the ST virtual COM port
+#define CDC_PID 0x5740
+
+#define CDC_EP0_SIZE 64
+#define CDC_DATA_SIZE 64 // Bulk packets at full speed
+#define CDC_NOTIFY_SIZE 8
+#define CDC_EP_DATA 1 // Bulk IN and OUT
+#define CDC_EP_NOTIFY 2 // Interrupt IN, required by the class but never used
+#define CDC_EP_COUNT 3
+#define CDC_TRANSFER_MAX (1023 * CDC_DATA_SIZE) // The packet count of a transfer has 10 bits
+
+// The 320 words of FIFO RAM are shared by the reception FIFO and the transmit FIFO of each IN endpoint
+#define CDC_FIFO_RX_WORDS 128
+#define CDC_FIFO_EP0_WORDS 32
+#define CDC_FIFO_DATA_WORDS 128
+#define CDC_FIFO_NOTIFY_WORDS 16
+
+#define CDC_GLOBAL USB_OTG_FS
+#define CDC_DEVICE ((USB_OTG_DeviceTypeDef*) (USB_OTG_FS_PERIPH_BASE + USB_OTG_DEVICE_BASE))
+#define CDC_IN(ep) ((USB_OTG_INEndpointTypeDef*) (USB_OTG_FS_PERIPH_BASE + USB_OTG_IN_ENDPOINT_BASE + (ep) * USB_OTG_EP_REG_SIZE))
+#define CDC_OUT(ep) ((USB_OTG_OUTEndpointTypeDef*) (USB_OTG_FS_PERIPH_BASE + USB_OTG_OUT_ENDPOINT_BASE + (ep) * USB_OTG_EP_REG_SIZE))
+#define CDC_FIFO(ep) (*(__IO uint32_t*) (USB_OTG_FS_PERIPH_BASE + USB_OTG_FIFO_BASE + (ep) * USB_OTG_FIFO_SIZE))
+#define CDC_PCGCCTL (*(__IO uint32_t*) (USB_OTG_FS_PERIPH_BASE + USB_OTG_PCGCCTL_BASE))
+
+#define CDC_WAIT_MAX 100000 // Register polling iterations, about 5 ms at 96 MHz
+
+#define PKTSTS_OUT_DATA 2
+#define PKTSTS_SETUP_DATA 6
+
+#define REQ_DIR_IN 0x80
+#define REQ_TYPE_MASK 0x60
+#define REQ_TYPE_STANDARD 0x00
+#define REQ_TYPE_CLASS 0x20
+#define REQ_RECIPIENT_MASK 0x1F
+#define REQ_RECIPIENT_ENDPOINT 0x02
+
+#define REQ_GET_STATUS 0x00
+#define REQ_CLEAR_FEATURE 0x01
+#define REQ_SET_FEATURE 0x03
+#define REQ_SET_ADDRESS 0x05
+#define REQ_GET_DESCRIPTOR 0x06
+#define REQ_GET_CONFIGURATION 0x08
+#define REQ_SET_CONFIGURATION 0x09
+#define REQ_GET_INTERFACE 0x0A
+#define REQ_SET_INTERFACE 0x0B
+
+#define REQ_SET_LINE_CODING 0x20
+#define REQ_GET_LINE_CODING 0x21
+#define REQ_SET_CONTROL_LINE_STATE 0x22
+#define REQ_SEND_BREAK 0x23
+
+#define DESC_DEVICE 0x01
+#define DESC_CONFIGURATION 0x02
+#define DESC_STRING 0x03
+
+#define STRING_MANUFACTURER 1
+#define STRING_PRODUCT 2
+#define STRING_SERIAL 3
+
+#define LINE_CODING_SIZE 7
+
+typedef struct __attribute__((packed)) cdc_setup
+{
+    uint8_t request_type;
+    uint8_t request;
+    uint16_t value;
+    uint16_t index;
+    uint16_t length;
+} cdc_setup_t;
+
+static const uint8_t cdc_device_desc[] = {
+    18, DESC_DEVICE, 0x00, 0x02, // USB 2.0
+    0x02, 0x00, 0x00, // Communication device class
+    CDC_EP0_SIZE,
+    CDC_VID & 0xFF, CDC_VID >> 8, CDC_PID & 0xFF, CDC_PID >> 8,
+    0x00, 0x02, // Release 2.00
+    STRING_MANUFACTURER, STRING_PRODUCT, STRING_SERIAL,
+    1 // Configurations
+};
+
+static const uint8_t cdc_config_desc[] = {
+    9, DESC_CONFIGURATION, 67, 0, 2, 1, 0, 0xC0, 50, // 2 interfaces, self powered, 100 mA
+    // Communication interface, abstract control model
+    9, 0x04, 0, 0, 1, 0x02, 0x02, 0x01, 0,
+    5, 0x24, 0x00, 0x10, 0x01, // Header, CDC 1.10
+    5, 0x24, 0x01, 0x00, 1, // Call management, no call handled
+    4, 0x24, 0x02, 0x02, // Line coding and serial state
+    5, 0x24, 0x06, 0, 1, // Union of the two interfaces
+    7, 0x05, 0x80 | CDC_EP_NOTIFY, 0x03, CDC_NOTIFY_SIZE, 0, 16,
+    // Data interface
+    9, 0x04, 1, 0, 2, 0x0A, 0x00, 0x00, 0,
+    7, 0x05, CDC_EP_DATA, 0x02, CDC_DATA_SIZE, 0, 0,
+    7, 0x05, 0x80 | CDC_EP_DATA, 0x02, CDC_DATA_SIZE, 0, 0
+};
+
+static const uint8_t cdc_langid_desc[] = {4, DESC_STRING, 0x09, 0x04}; // English (United States)
+static const char *const cdc_strings[] = {"", "STMicroelectronics", "RoomMapper"};
+
+static uint32_t cdc_setup_words[2]; // Last SETUP packet, read from the FIFO by words
+static uint8_t cdc_ep0_buf[CDC_EP0_SIZE]; // Descriptors built on request and data stage of the control OUT requests
+static uint8_t cdc_ep0_request = 0; // Request waiting for its data stage, 0 if none
+static uint8_t cdc_line_coding[LINE_CODING_SIZE] = {0x00, 0xC2, 0x01, 0x00, 0, 0, 8}; // 115200 8N1, only reported
+static volatile bool cdc_configured = false;
+static volatile bool cdc_suspended = false;
+
+static volatile bool cdc_tx_busy = false;
+static const uint8_t *cdc_tx_data = NULL; // Next byte written in the FIFO
+static uint16_t cdc_tx_left = 0; // Bytes not yet written in the FIFO
+static bool cdc_tx_zlp = false; // The transfer ends on a full packet and needs a zero length packet
+
+static bool _Wait(__IO uint32_t *reg, uint32_t mask, uint32_t value);
+static void _FlushTxFifo(uint8_t fifo);
+static void _FlushRxFifo(void);
+static void _ReadFifo(uint8_t *data, uint16_t length);
+static void _WriteFifo(uint8_t ep, const uint8_t *data, uint16_t length);
+static void _Reset(void);
+static void _Enumerated(void);
+static void _ReadPacket(void);
+static void _OutEndpoints(void);
+static void _InEndpoints(void);
+static void _ReceiveSetup(uint16_t length);
+static void _ReceiveData(void);
+static void _ControlSend(const uint8_t *data, uint16_t length);
+static void _ControlStatus(void);
+static void _ControlStall(void);
+static void _Setup(void);
+static bool _StandardRequest(const cdc_setup_t *setup);
+static bool _ClassRequest(const cdc_setup_t *setup);
+static bool _SendDescriptor(uint16_t value);
+static void _SendString(const char *str);
+static bool _SetHalt(uint8_t address, bool halt);
+static void _Configure(bool configured);
+static void _FillFifo(void);
+static void _TransmitDone(void);
+static void _AbortTransmit(void);
+
+void CDC_Init(void)
+{
+    GPIO_InitTypeDef gpio = {0};
+
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    gpio.Pin = GPIO_PIN_11 | GPIO_PIN_12;
+    gpio.Mode = GPIO_MODE_AF_PP;
+    gpio.Pull = GPIO_NOPULL;
+    gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+    gpio.Alternate = GPIO_AF10_OTG_FS;
+    HAL_GPIO_Init(GPIOA, &gpio);
+    __HAL_RCC_USB_OTG_FS_CLK_ENABLE();
+
+    // Core reset with the embedded full speed transceiver
+    CDC_GLOBAL->GUSBCFG |= USB_OTG_GUSBCFG_PHYSEL;
+    _Wait(&CDC_GLOBAL->GRSTCTL, USB_OTG_GRSTCTL_AHBIDL, USB_OTG_GRSTCTL_AHBIDL);
+    CDC_GLOBAL->GRSTCTL |= USB_OTG_GRSTCTL_CSRST;
+    _Wait(&CDC_GLOBAL->GRSTCTL, USB_OTG_GRSTCTL_CSRST, 0);
+
+    // Transceiver on, VBUS (PA9) is not connected so the session is always valid
+    CDC_GLOBAL->GCCFG = USB_OTG_GCCFG_PWRDWN | USB_OTG_GCCFG_NOVBUSSENS;
+
+    // Forced device mode, turnaround time for an AHB clock above 32 MHz
+    CDC_GLOBAL->GUSBCFG = (CDC_GLOBAL->GUSBCFG & ~(USB_OTG_GUSBCFG_FHMOD | USB_OTG_GUSBCFG_TRDT))
+            | USB_OTG_GUSBCFG_FDMOD | (6 << USB_OTG_GUSBCFG_TRDT_Pos);
+    HAL_Delay(50); // The mode change takes 25 ms
+
+    // Stay disconnected until the device is ready
+    CDC_PCGCCTL = 0;
+    CDC_DEVICE->DCTL |= USB_OTG_DCTL_SDIS;
+    CDC_DEVICE->DCFG |= USB_OTG_DCFG_DSPD; // Full speed
+
+    CDC_GLOBAL->GRXFSIZ = CDC_FIFO_RX_WORDS;
+    CDC_GLOBAL->DIEPTXF0_HNPTXFSIZ = (CDC_FIFO_EP0_WORDS << 16) | CDC_FIFO_RX_WORDS;
+    CDC_GLOBAL->DIEPTXF[CDC_EP_DATA - 1] = (CDC_FIFO_DATA_WORDS << 16) | (CDC_FIFO_RX_WORDS + CDC_FIFO_EP0_WORDS);
+    CDC_GLOBAL->DIEPTXF[CDC_EP_NOTIFY - 1] = (CDC_FIFO_NOTIFY_WORDS << 16)
+            | (CDC_FIFO_RX_WORDS + CDC_FIFO_EP0_WORDS + CDC_FIFO_DATA_WORDS);
+    _FlushTxFifo(0x10);
+    _FlushRxFifo();
+
+    CDC_DEVICE->DIEPMSK = USB_OTG_DIEPMSK_XFRCM;
+    CDC_DEVICE->DOEPMSK = USB_OTG_DOEPMSK_STUPM | USB_OTG_DOEPMSK_XFRCM;
+    CDC_DEVICE->DAINTMSK = 0;
+    CDC_DEVICE->DIEPEMPMSK = 0;
+    CDC_GLOBAL->GINTSTS = 0xFFFFFFFF;
+    CDC_GLOBAL->GINTMSK = USB_OTG_GINTMSK_USBRST | USB_OTG_GINTMSK_ENUMDNEM | USB_OTG_GINTMSK_RXFLVLM
+            | USB_OTG_GINTMSK_IEPINT | USB_OTG_GINTMSK_OEPINT | USB_OTG_GINTMSK_USBSUSPM | USB_OTG_GINTMSK_WUIM;
+    CDC_GLOBAL->GAHBCFG |= USB_OTG_GAHBCFG_GINT;
+
+    HAL_NVIC_SetPriority(OTG_FS_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+
+    // Pull-up on D+, the host starts the enumeration with a bus reset
+    CDC_DEVICE->DCTL &= ~USB_OTG_DCTL_SDIS;
+}
+
+bool CDC_Transmit(const uint8_t *data, uint16_t length)
+{
+    bool started = false;
+
+    if (length == 0 || length > CDC_TRANSFER_MAX)
+    {
+        return false;
+    }
+
+    // A reset or a suspend from the interrupt must not interleave with the start of the transfer
+    HAL_NVIC_DisableIRQ(OTG_FS_IRQn);
+    if (cdc_configured && !cdc_suspended && !cdc_tx_busy)
+    {
+        cdc_tx_busy = true;
+        cdc_tx_data = data;
+        cdc_tx_left = length;
+        // The host only returns a transfer ending on a full packet once the zero length packet is received
+        cdc_tx_zlp = (length % CDC_DATA_SIZE) == 0;
+
+        CDC_IN(CDC_EP_DATA)->DIEPTSIZ = (((length + CDC_DATA_SIZE - 1) / CDC_DATA_SIZE) << USB_OTG_DIEPTSIZ_PKTCNT_Pos)
+                | length;
+        CDC_IN(CDC_EP_DATA)->DIEPCTL |= USB_OTG_DIEPCTL_CNAK | USB_OTG_DIEPCTL_EPENA;
+        // The FIFO is filled from the interrupt each time it has room for a packet
+        CDC_DEVICE->DIEPEMPMSK |= 1 << CDC_EP_DATA;
+        started = true;
+    }
+    HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+    return started;
+}
+
+bool CDC_IsConnected(void)
+{
+    return cdc_configured && !cdc_suspended;
+}
+
+void CDC_IRQHandler(void)
+{
+    uint32_t status = CDC_GLOBAL->GINTSTS & CDC_GLOBAL->GINTMSK;
+
+    if (status & USB_OTG_GINTSTS_USBRST)
+    {
+        CDC_GLOBAL->GINTSTS = USB_OTG_GINTSTS_USBRST;
+        _Reset();
+    }
+    if (status & USB_OTG_GINTSTS_ENUMDNE)
+    {
+        CDC_GLOBAL->GINTSTS = USB_OTG_GINTSTS_ENUMDNE;
+        _Enumerated();
+    }
+    if (status & USB_OTG_GINTSTS_RXFLVL)
+    {
+        _ReadPacket();
+    }
+    if (status & USB_OTG_GINTSTS_OEPINT)
+    {
+        _OutEndpoints();
+    }
+    if (status & USB_OTG_GINTSTS_IEPINT)
+    {
+        _InEndpoints();
+    }
+    if (status & USB_OTG_GINTSTS_USBSUSP)
+    {
+        // Also the cable being unplugged since VBUS is not sensed
+        CDC_GLOBAL->GINTSTS = USB_OTG_GINTSTS_USBSUSP;
+        cdc_suspended = true;
+        _AbortTransmit();
+    }
+    if (status & USB_OTG_GINTSTS_WKUINT)
+    {
+        CDC_GLOBAL->GINTSTS = USB_OTG_GINTSTS_WKUINT;
+        cdc_suspended = false;
+    }
+}
+
+/**
+ * Strong definition of the link transport, see link.h.
+ */
+bool LINK_Send(const uint8_t *data, uint16_t length)
+{
+    return CDC_Transmit(data, length);
+}
+
+static bool _Wait(__IO uint32_t *reg, uint32_t mask, uint32_t value)
+{
+    for (uint32_t i = 0; i < CDC_WAIT_MAX; i++)
+    {
+        if ((*reg & mask) == value)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void _FlushTxFifo(uint8_t fifo)
+{
+    _Wait(&CDC_GLOBAL->GRSTCTL, USB_OTG_GRSTCTL_AHBIDL, USB_OTG_GRSTCTL_AHBIDL);
+    CDC_GLOBAL->GRSTCTL = USB_OTG_GRSTCTL_TXFFLSH | ((uint32_t) fifo << USB_OTG_GRSTCTL_TXFNUM_Pos);
+    _Wait(&CDC_GLOBAL->GRSTCTL, USB_OTG_GRSTCTL_TXFFLSH, 0);
+}
+
+static void _FlushRxFifo(void)
+{
+    _Wait(&CDC_GLOBAL->GRSTCTL, USB_OTG_GRSTCTL_AHBIDL, USB_OTG_GRSTCTL_AHBIDL);
+    CDC_GLOBAL->GRSTCTL = USB_OTG_GRSTCTL_RXFFLSH;
+    _Wait(&CDC_GLOBAL->GRSTCTL, USB_OTG_GRSTCTL_RXFFLSH, 0);
+}
+
+/**
+ * Pop a received packet from the FIFO, the bytes are dropped if `data` is NULL.
+ */
+static void _ReadFifo(uint8_t *data, uint16_t length)
+{
+    while (length > 0)
+    {
+        uint32_t word = CDC_FIFO(0);
+        uint16_t size = length < 4 ? length : 4;
+
+        if (data != NULL)
+        {
+            memcpy(data, &word, size);
+            data += size;
+        }
+        length -= size;
+    }
+}
+
+static void _WriteFifo(uint8_t ep, const uint8_t *data, uint16_t length)
+{
+    while (length > 0)
+    {
+        uint32_t word = 0;
+        uint16_t size = length < 4 ? length : 4;
+
+        memcpy(&word, data, size);
+        CDC_FIFO(ep) = word;
+        data += size;
+        length -= size;
+    }
+}
+
+static void _Reset(void)
+{
+    cdc_suspended = false;
+    _Configure(false);
+
+    CDC_DEVICE->DCTL &= ~USB_OTG_DCTL_RWUSIG;
+    _FlushTxFifo(0x10);
+    for (uint8_t ep = 0; ep < CDC_EP_COUNT; ep++)
+    {
+        CDC_IN(ep)->DIEPINT = 0xFB7F;
+        CDC_IN(ep)->DIEPCTL = (CDC_IN(ep)->DIEPCTL & ~USB_OTG_DIEPCTL_STALL) | USB_OTG_DIEPCTL_SNAK;
+        CDC_OUT(ep)->DOEPINT = 0xFB7F;
+        CDC_OUT(ep)->DOEPCTL = (CDC_OUT(ep)->DOEPCTL & ~USB_OTG_DOEPCTL_STALL) | USB_OTG_DOEPCTL_SNAK;
+    }
+
+    CDC_DEVICE->DAINTMSK = (1 << 0) | (1 << 16); // Control IN and OUT
+    CDC_DEVICE->DCFG &= ~USB_OTG_DCFG_DAD;
+    cdc_ep0_request = 0;
+    _ReceiveSetup(0);
+}
+
+static void _Enumerated(void)
+{
+    // MPSIZ 0 is 64 bytes for the control endpoint
+    CDC_IN(0)->DIEPCTL &= ~USB_OTG_DIEPCTL_MPSIZ;
+    CDC_DEVICE->DCTL |= USB_OTG_DCTL_CGINAK;
+}
+
+static void _ReadPacket(void)
+{
+    CDC_GLOBAL->GINTMSK &= ~USB_OTG_GINTMSK_RXFLVLM;
+
+    uint32_t status = CDC_GLOBAL->GRXSTSP;
+    uint8_t ep = status & USB_OTG_GRXSTSP_EPNUM;
+    uint16_t count = (status & USB_OTG_GRXSTSP_BCNT) >> USB_OTG_GRXSTSP_BCNT_Pos;
+    uint8_t type = (status & USB_OTG_GRXSTSP_PKTSTS) >> USB_OTG_GRXSTSP_PKTSTS_Pos;
+
+    if (type == PKTSTS_SETUP_DATA)
+    {
+        _ReadFifo((uint8_t*) cdc_setup_words, count);
+    }
+    else if (type == PKTSTS_OUT_DATA && count > 0)
+    {
+        // Only the data stage of the control requests is kept, the data sent on the bulk endpoint is dropped
+        if (ep == 0 && count <= sizeof(cdc_ep0_buf))
+        {
+            _ReadFifo(cdc_ep0_buf, count);
+        }
+        else
+        {
+            _ReadFifo(NULL, count);
+        }
+    }
+
+    CDC_GLOBAL->GINTMSK |= USB_OTG_GINTMSK_RXFLVLM;
+}
+
+static void _OutEndpoints(void)
+{
+    uint32_t pending = (CDC_DEVICE->DAINT & CDC_DEVICE->DAINTMSK) >> 16;
+
+    for (uint8_t ep = 0; ep < CDC_EP_COUNT; ep++)
+    {
+        if (!(pending & (1 << ep)))
+        {
+            continue;
+        }
+
+        uint32_t flags = CDC_OUT(ep)->DOEPINT & CDC_DEVICE->DOEPMSK;
+        CDC_OUT(ep)->DOEPINT = flags;
+
+        if (flags & USB_OTG_DOEPINT_XFRC)
+        {
+            if (ep == CDC_EP_DATA)
+            {
+                _ReceiveData();
+            }
+            else if (ep == 0 && cdc_ep0_request == REQ_SET_LINE_CODING)
+            {
+                memcpy(cdc_line_coding, cdc_ep0_buf, LINE_CODING_SIZE);
+                cdc_ep0_request = 0;
+                _ControlStatus();
+            }
+        }
+        // After the transfer complete, a status stage may be followed by the next SETUP
+        if (ep == 0 && (flags & USB_OTG_DOEPINT_STUP))
+        {
+            _Setup();
+        }
+    }
+}
+
+static void _InEndpoints(void)
+{
+    uint32_t pending = CDC_DEVICE->DAINT & CDC_DEVICE->DAINTMSK & 0xFFFF;
+
+    for (uint8_t ep = 0; ep < CDC_EP_COUNT; ep++)
+    {
+        if (!(pending & (1 << ep)))
+        {
+            continue;
+        }
+
+        uint32_t mask = CDC_DEVICE->DIEPMSK;
+        if (CDC_DEVICE->DIEPEMPMSK & (1 << ep))
+        {
+            mask |= USB_OTG_DIEPINT_TXFE;
+        }
+        uint32_t flags = CDC_IN(ep)->DIEPINT & mask;
+
+        if (flags & USB_OTG_DIEPINT_XFRC)
+        {
+            CDC_IN(ep)->DIEPINT = USB_OTG_DIEPINT_XFRC;
+            if (ep == CDC_EP_DATA)
+            {
+                _TransmitDone();
+            }
+        }
+        if ((flags & USB_OTG_DIEPINT_TXFE) && ep == CDC_EP_DATA)
+        {
+            _FillFifo();
+        }
+    }
+}
+
+/**
+ * Arm the control OUT endpoint, for the next SETUP packets and the data or status stage of `length` bytes.
+ */
+static void _ReceiveSetup(uint16_t length)
+{
+    CDC_OUT(0)->DOEPTSIZ = (3 << USB_OTG_DOEPTSIZ_STUPCNT_Pos) | (1 << USB_OTG_DOEPTSIZ_PKTCNT_Pos)
+            | (length > 0 ? length : 3 * 8);
+    if (length > 0)
+    {
+        CDC_OUT(0)->DOEPCTL |= USB_OTG_DOEPCTL_CNAK | USB_OTG_DOEPCTL_EPENA;
+    }
+}
+
+static void _ReceiveData(void)
+{
+    CDC_OUT(CDC_EP_DATA)->DOEPTSIZ = (1 << USB_OTG_DOEPTSIZ_PKTCNT_Pos) | CDC_DATA_SIZE;
+    CDC_OUT(CDC_EP_DATA)->DOEPCTL |= USB_OTG_DOEPCTL_CNAK | USB_OTG_DOEPCTL_EPENA;
+}
+
+/**
+ * Data stage of a control IN request, the whole answer fits in the control FIFO.
+ */
+static void _ControlSend(const uint8_t *data, uint16_t length)
+{
+    const cdc_setup_t *setup = (const cdc_setup_t*) cdc_setup_words;
+    uint16_t packets;
+
+    if (length > setup->length)
+    {
+        length = setup->length;
+    }
+    // A shorter answer ending on a full packet is terminated by a zero length packet
+    packets = (length + CDC_EP0_SIZE - 1) / CDC_EP0_SIZE;
+    if (length % CDC_EP0_SIZE == 0 && length < setup->length)
+    {
+        packets++;
+    }
+
+    CDC_IN(0)->DIEPTSIZ = (packets << USB_OTG_DIEPTSIZ_PKTCNT_Pos) | length;
+    CDC_IN(0)->DIEPCTL |= USB_OTG_DIEPCTL_CNAK | USB_OTG_DIEPCTL_EPENA;
+    _WriteFifo(0, data, length);
+
+    // Status stage sent by the host
+    _ReceiveSetup(CDC_EP0_SIZE);
+}
+
+static void _ControlStatus(void)
+{
+    CDC_IN(0)->DIEPTSIZ = 1 << USB_OTG_DIEPTSIZ_PKTCNT_Pos;
+    CDC_IN(0)->DIEPCTL |= USB_OTG_DIEPCTL_CNAK | USB_OTG_DIEPCTL_EPENA;
+}
+
+static void _ControlStall(void)
+{
+    // Cleared by the core on the next SETUP packet
+    CDC_IN(0)->DIEPCTL |= USB_OTG_DIEPCTL_STALL;
+    CDC_OUT(0)->DOEPCTL |= USB_OTG_DOEPCTL_STALL;
+    _ReceiveSetup(0);
+}
+
+static void _Setup(void)
+{
+    const cdc_setup_t *setup = (const cdc_setup_t*) cdc_setup_words;
+    bool handled = false;
+
+    cdc_ep0_request = 0;
+    _ReceiveSetup(0);
+
+    switch (setup->request_type & REQ_TYPE_MASK)
+    {
+    case REQ_TYPE_STANDARD:
+        handled = _StandardRequest(setup);
+        break;
+    case REQ_TYPE_CLASS:
+        handled = _ClassRequest(setup);
+        break;
+    default:
+        break;
+    }
+
+    if (!handled)
+    {
+        _ControlStall();
+    }
+}
+
+static bool _StandardRequest(const cdc_setup_t *setup)
+{
+    switch (setup->request)
+    {
+    case REQ_GET_STATUS:
+        // Self powered device, no halted endpoint reported
+        cdc_ep0_buf[0] = (setup->request_type & REQ_RECIPIENT_MASK) == 0 ? 0x01 : 0x00;
+        cdc_ep0_buf[1] = 0;
+        _ControlSend(cdc_ep0_buf, 2);
+        return true;
+    case REQ_CLEAR_FEATURE:
+    case REQ_SET_FEATURE:
+        // Only the endpoint halt feature, remote wakeup is not supported
+        if ((setup->request_type & REQ_RECIPIENT_MASK) != REQ_RECIPIENT_ENDPOINT || setup->value != 0)
+        {
+            return false;
+        }
+        if (!_SetHalt(setup->index, setup->request == REQ_SET_FEATURE))
+        {
+            return false;
+        }
+        _ControlStatus();
+        return true;
+    case REQ_SET_ADDRESS:
+        // Applied before the status stage, the core answers it on the old address
+        CDC_DEVICE->DCFG = (CDC_DEVICE->DCFG & ~USB_OTG_DCFG_DAD)
+                | ((setup->value & 0x7F) << USB_OTG_DCFG_DAD_Pos);
+        _ControlStatus();
+        return true;
+    case REQ_GET_DESCRIPTOR:
+        return _SendDescriptor(setup->value);
+    case REQ_GET_CONFIGURATION:
+        cdc_ep0_buf[0] = cdc_configured ? 1 : 0;
+        _ControlSend(cdc_ep0_buf, 1);
+        return true;
+    case REQ_SET_CONFIGURATION:
+        if (setup->value > 1)
+        {
+            return false;
+        }
+        _Configure(setup->value == 1);
+        _ControlStatus();
+        return true;
+    case REQ_GET_INTERFACE:
+        cdc_ep0_buf[0] = 0;
+        _ControlSend(cdc_ep0_buf, 1);
+        return true;
+    case REQ_SET_INTERFACE:
+        _ControlStatus();
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool _ClassRequest(const cdc_setup_t *setup)
+{
+    switch (setup->request)
+    {
+    case REQ_SET_LINE_CODING:
+        if (setup->length != LINE_CODING_SIZE)
+        {
+            return false;
+        }
+        // Acknowledged once the data stage is received
+        cdc_ep0_request = REQ_SET_LINE_CODING;
+        _ReceiveSetup(LINE_CODING_SIZE);
+        return true;
+    case REQ_GET_LINE_CODING:
+        _ControlSend(cdc_line_coding, LINE_CODING_SIZE);
+        return true;
+    case REQ_SET_CONTROL_LINE_STATE:
+    case REQ_SEND_BREAK:
+        _ControlStatus();
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool _SendDescriptor(uint16_t value)
+{
+    uint8_t type = value >> 8;
+    uint8_t index = value & 0xFF;
+
+    switch (type)
+    {
+    case DESC_DEVICE:
+        _ControlSend(cdc_device_desc, sizeof(cdc_device_desc));
+        return true;
+    case DESC_CONFIGURATION:
+        _ControlSend(cdc_config_desc, sizeof(cdc_config_desc));
+        return true;
+    case DESC_STRING:
+        if (index == 0)
+        {
+            _ControlSend(cdc_langid_desc, sizeof(cdc_langid_desc));
+        }
+        else if (index == STRING_SERIAL)
+        {
+            // Unique ID of the device, same derivation as the ST virtual COM port
+            char serial[13];
+            uint32_t id[2] = {HAL_GetUIDw0() + HAL_GetUIDw2(), HAL_GetUIDw1()};
+
+            for (uint8_t i = 0; i < 12; i++)
+            {
+                uint8_t digit = i < 8 ? (id[0] >> (28 - 4 * i)) & 0xF : (id[1] >> (28 - 4 * (i - 8))) & 0xF;
+                serial[i] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+            }
+            serial[12] = '\0';
+            _SendString(serial);
+        }
+        else if (index < sizeof(cdc_strings) / sizeof(cdc_strings[0]))
+        {
+            _SendString(cdc_strings[index]);
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    default:
+        // No device qualifier, full speed only
+        return false;
+    }
+}
+
+static void _SendString(const char *str)
+{
+    uint8_t length = 0;
+
+    // UTF-16LE, at most 31 characters in the control buffer
+    while (str[length] != '\0' && length < (CDC_EP0_SIZE - 2) / 2)
+    {
+        cdc_ep0_buf[2 + 2 * length] = str[length];
+        cdc_ep0_buf[3 + 2 * length] = 0;
+        length++;
+    }
+    cdc_ep0_buf[0] = 2 + 2 * length;
+    cdc_ep0_buf[1] = DESC_STRING;
+    _ControlSend(cdc_ep0_buf, cdc_ep0_buf[0]);
+}
+
+static bool _SetHalt(uint8_t address, bool halt)
+{
+    uint8_t ep = address & 0x7F;
+
+    if (ep == 0 || ep >= CDC_EP_COUNT)
+    {
+        return ep == 0;
+    }
+
+    if (address & REQ_DIR_IN)
+    {
+        if (halt)
+        {
+            CDC_IN(ep)->DIEPCTL |= USB_OTG_DIEPCTL_STALL;
+        }
+        else
+        {
+            CDC_IN(ep)->DIEPCTL = (CDC_IN(ep)->DIEPCTL & ~USB_OTG_DIEPCTL_STALL) | USB_OTG_DIEPCTL_SD0PID_SEVNFRM;
+        }
+    }
+    else
+    {
+        if (halt)
+        {
+            CDC_OUT(ep)->DOEPCTL |= USB_OTG_DOEPCTL_STALL;
+        }
+        else
+        {
+            CDC_OUT(ep)->DOEPCTL = (CDC_OUT(ep)->DOEPCTL & ~USB_OTG_DOEPCTL_STALL) | USB_OTG_DOEPCTL_SD0PID_SEVNFRM;
+        }
+    }
+    return true;
+}
+
+static void _Configure(bool configured)
+{
+    if (configured && !cdc_configured)
+    {
+        CDC_IN(CDC_EP_DATA)->DIEPCTL = USB_OTG_DIEPCTL_USBAEP | USB_OTG_DIEPCTL_SD0PID_SEVNFRM
+                | (2 << USB_OTG_DIEPCTL_EPTYP_Pos) | (CDC_EP_DATA << USB_OTG_DIEPCTL_TXFNUM_Pos) | CDC_DATA_SIZE;
+        CDC_IN(CDC_EP_NOTIFY)->DIEPCTL = USB_OTG_DIEPCTL_USBAEP | USB_OTG_DIEPCTL_SD0PID_SEVNFRM
+                | (3 << USB_OTG_DIEPCTL_EPTYP_Pos) | (CDC_EP_NOTIFY << USB_OTG_DIEPCTL_TXFNUM_Pos) | CDC_NOTIFY_SIZE;
+        CDC_OUT(CDC_EP_DATA)->DOEPCTL = USB_OTG_DOEPCTL_USBAEP | USB_OTG_DOEPCTL_SD0PID_SEVNFRM
+                | (2 << USB_OTG_DOEPCTL_EPTYP_Pos) | CDC_DATA_SIZE;
+        CDC_DEVICE->DAINTMSK |= (1 << CDC_EP_DATA) | (1 << CDC_EP_NOTIFY) | (1 << (16 + CDC_EP_DATA));
+        _ReceiveData();
+        cdc_configured = true;
+    }
+    else if (!configured && cdc_configured)
+    {
+        cdc_configured = false;
+        _AbortTransmit();
+        CDC_DEVICE->DAINTMSK &= ~((1 << CDC_EP_DATA) | (1 << CDC_EP_NOTIFY) | (1 << (16 + CDC_EP_DATA)));
+        for (uint8_t ep = 1; ep < CDC_EP_COUNT; ep++)
+        {
+            CDC_IN(ep)->DIEPCTL &= ~USB_OTG_DIEPCTL_USBAEP;
+            CDC_OUT(ep)->DOEPCTL &= ~USB_OTG_DOEPCTL_USBAEP;
+        }
+    }
+}
+
+static void _FillFifo(void)
+{
+    // Whole packets only, the free space is counted in words
+    while (cdc_tx_left > 0)
+    {
+        uint16_t size = cdc_tx_left < CDC_DATA_SIZE ? cdc_tx_left : CDC_DATA_SIZE;
+
+        if ((CDC_IN(CDC_EP_DATA)->DTXFSTS & USB_OTG_DTXFSTS_INEPTFSAV) < (uint32_t) (size + 3) / 4)
+        {
+            break;
+        }
+        _WriteFifo(CDC_EP_DATA, cdc_tx_data, size);
+        cdc_tx_data += size;
+        cdc_tx_left -= size;
+    }
+
+    if (cdc_tx_left == 0)
+    {
+        CDC_DEVICE->DIEPEMPMSK &= ~(1 << CDC_EP_DATA);
+    }
+}
+
+static void _TransmitDone(void)
+{
+    if (!cdc_tx_busy)
+    {
+        return;
+    }
+
+    if (cdc_tx_zlp)
+    {
+        cdc_tx_zlp = false;
+        CDC_IN(CDC_EP_DATA)->DIEPTSIZ = 1 << USB_OTG_DIEPTSIZ_PKTCNT_Pos;
+        CDC_IN(CDC_EP_DATA)->DIEPCTL |= USB_OTG_DIEPCTL_CNAK | USB_OTG_DIEPCTL_EPENA;
+        return;
+    }
+
+    cdc_tx_busy = false;
+    LINK_TransmitComplete();
+}
+
+/**
+ * Stop the transfer in progress when the host goes away, the link must not wait for it forever.
+ */
+static void _AbortTransmit(void)
+{
+    if (!cdc_tx_busy)
+    {
+        return;
+    }
+
+    CDC_DEVICE->DIEPEMPMSK &= ~(1 << CDC_EP_DATA);
+    if (CDC_IN(CDC_EP_DATA)->DIEPCTL & USB_OTG_DIEPCTL_EPENA)
+    {
+        CDC_IN(CDC_EP_DATA)->DIEPCTL |= USB_OTG_DIEPCTL_SNAK;
+        _Wait(&CDC_IN(CDC_EP_DATA)->DIEPINT, USB_OTG_DIEPINT_INEPNE, USB_OTG_DIEPINT_INEPNE);
+        CDC_IN(CDC_EP_DATA)->DIEPCTL |= USB_OTG_DIEPCTL_EPDIS | USB_OTG_DIEPCTL_SNAK;
+        _Wait(&CDC_IN(CDC_EP_DATA)->DIEPINT, USB_OTG_DIEPINT_EPDISD, USB_OTG_DIEPINT_EPDISD);
+        CDC_IN(CDC_EP_DATA)->DIEPINT = USB_OTG_DIEPINT_EPDISD | USB_OTG_DIEPINT_INEPNE;
+    }
+    _FlushTxFifo(CDC_EP_DATA);
+
+    cdc_tx_left = 0;
+    cdc_tx_zlp = false;
+    cdc_tx_busy = false;
+    LINK_TransmitComplete();
+}
@@ -0,0 +1,157 @@
+/*
+ * cluster.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "cluster.h"
+
+#define CLUSTER_DEFAULT_BREAK_DISTANCE 150 // mm
+#define CLUSTER_DEFAULT_BREAK_ANGLE (2 * 64) // 2°
+#define CLUSTER_DEFAULT_SIZE_MIN 3
+
+static cluster_config_t cluster_config = {
+        .enabled = true,
+        .break_distance = CLUSTER_DEFAULT_BREAK_DISTANCE,
+        .break_angle = CLUSTER_DEFAULT_BREAK_ANGLE,
+        .size_min = CLUSTER_DEFAULT_SIZE_MIN};
+static cluster_stats_t cluster_stats = {0};
+
+static cluster_sample_t cluster_pending[CLUSTER_SIZE_MAX];
+static uint8_t cluster_pending_count = 0;
+static uint8_t cluster_size = 0;
+static uint16_t cluster_label = 0;
+static rplidar_measurement_t cluster_prev;
+static bool cluster_prev_valid = false;
+static bool cluster_start_lost = false;
+
+static bool _IsBreak(const rplidar_measurement_t *prev, const rplidar_measurement_t *cur);
+
+void CLUSTER_Reset(void)
+{
+    cluster_pending_count = 0;
+    cluster_size = 0;
+    cluster_prev_valid = false;
+    cluster_start_lost = false;
+}
+
+uint8_t CLUSTER_Process(const rplidar_measurement_t *measurement, uint32_t timestamp, cluster_sample_t *samples)
+{
+    uint8_t count = 0;
+
+    cluster_stats.processed++;
+
+    if (!cluster_config.enabled)
+    {
+        samples[0].measurement = *measurement;
+        samples[0].timestamp = timestamp;
+        samples[0].cluster = cluster_label;
+        return 1;
+    }
+
+    if (!cluster_prev_valid || _IsBreak(&cluster_prev, measurement))
+    {
+        if (cluster_size < cluster_config.size_min)
+        {
+            // Cluster too small, drop the held samples
+            for (uint8_t i = 0; i < cluster_pending_count; i++)
+            {
+                if (cluster_pending[i].measurement.start & 0x01)
+                {
+                    // Keep the revolution boundary for the next released sample
+                    cluster_start_lost = true;
+                }
+            }
+            cluster_stats.rejected += cluster_pending_count;
+        }
+        cluster_pending_count = 0;
+        cluster_size = 0;
+        cluster_label++;
+    }
+    cluster_prev = *measurement;
+    cluster_prev_valid = true;
+    if (cluster_size < UINT8_MAX)
+    {
+        cluster_size++;
+    }
+
+    if (cluster_size < cluster_config.size_min)
+    {
+        // Hold the sample until the cluster is large enough
+        cluster_pending[cluster_pending_count].measurement = *measurement;
+        cluster_pending[cluster_pending_count].timestamp = timestamp;
+        cluster_pending[cluster_pending_count].cluster = cluster_label;
+        cluster_pending_count++;
+        return 0;
+    }
+
+    if (cluster_size == cluster_config.size_min)
+    {
+        // Cluster accepted, release the held samples first
+        memcpy(samples, cluster_pending, cluster_pending_count * sizeof(cluster_sample_t));
+        count = cluster_pending_count;
+        cluster_pending_count = 0;
+        cluster_stats.clusters++;
+    }
+    samples[count].measurement = *measurement;
+    samples[count].timestamp = timestamp;
+    samples[count].cluster = cluster_label;
+    count++;
+
+    if (cluster_start_lost)
+    {
+        samples[0].measurement.start = 0x01;
+        cluster_start_lost = false;
+    }
+
+    return count;
+}
+
+void CLUSTER_SetConfig(const cluster_config_t *config)
+{
+    cluster_config = *config;
+    if (cluster_config.size_min < 1)
+    {
+        cluster_config.size_min = 1;
+    }
+    else if (cluster_config.size_min > CLUSTER_SIZE_MAX)
+    {
+        cluster_config.size_min = CLUSTER_SIZE_MAX;
+    }
+    CLUSTER_Reset();
+}
+
+void CLUSTER_GetConfig(cluster_config_t *config)
+{
+    *config = cluster_config;
+}
+
+void CLUSTER_GetStats(cluster_stats_t *stats)
+{
+    *stats = cluster_stats;
+}
+
+/* Integer only, the range jump threshold grows with the distance as samples spread apart */
+static bool _IsBreak(const rplidar_measurement_t *prev, const rplidar_measurement_t *cur)
+{
+    uint16_t prev_mm = prev->distance >> 2;
+    uint16_t cur_mm = cur->distance >> 2;
+    uint16_t jump = prev_mm > cur_mm ? prev_mm - cur_mm : cur_mm - prev_mm;
+    int32_t gap = (int32_t) cur->angle - prev->angle;
+
+    // Shortest angle between the samples, across 0° at the start of a revolution
+    if (gap < 0)
+    {
+        gap = -gap;
+    }
+    if (gap > 180 * 64)
+    {
+        gap = 360 * 64 - gap;
+    }
+
+    return jump > cluster_config.break_distance + (cur_mm >> 4) || gap > cluster_config.break_angle;
+}
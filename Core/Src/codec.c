@@ -0,0 +1,280 @@
+/*
+ * codec.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "codec.h"
+
+#define CODEC_FLAG_TRUNCATED 0x01
+#define CODEC_FLAG_CONSTANT_QUALITY 0x02 // All samples share the quality of the header, no quality bits
+#define CODEC_QUALITY_BITS 6
+#define CODEC_QUALITY_MASK 0x3F
+#define CODEC_VARINT_MAX 3 // 21 bits, enough for the difference of two 16-bit values
+
+static uint16_t _PutVarint(uint8_t *buffer, uint16_t idx, int32_t value);
+static uint16_t _GetVarint(const uint8_t *buffer, uint16_t idx, uint16_t end, int32_t *value);
+static void _PutU16(uint8_t *buffer, uint16_t value);
+static void _PutU32(uint8_t *buffer, uint32_t value);
+static uint16_t _GetU16(const uint8_t *buffer);
+static uint32_t _GetU32(const uint8_t *buffer);
+
+uint16_t CODEC_EncodeSweep(const sweep_frame_t *frame, uint8_t *buffer, uint16_t size)
+{
+    uint16_t idx = CODEC_HEADER_SIZE;
+    uint8_t flags = frame->truncated ? CODEC_FLAG_TRUNCATED : 0;
+    uint8_t quality = frame->count > 0 ? frame->samples[0].quality : 0;
+
+    flags |= CODEC_FLAG_CONSTANT_QUALITY;
+    for (uint16_t i = 1; i < frame->count; i++)
+    {
+        if (frame->samples[i].quality != quality)
+        {
+            flags &= ~CODEC_FLAG_CONSTANT_QUALITY;
+            quality = 0;
+            break;
+        }
+    }
+
+    // Samples are ordered by angle and neighbours see close distances, so the differences are small
+    int32_t angle = 0;
+    int32_t distance = 0;
+    for (uint16_t i = 0; i < frame->count; i++)
+    {
+        if (idx + 2 * CODEC_VARINT_MAX > size)
+        {
+            return 0;
+        }
+        idx = _PutVarint(buffer, idx, frame->samples[i].angle - angle);
+        idx = _PutVarint(buffer, idx, frame->samples[i].distance - distance);
+        angle = frame->samples[i].angle;
+        distance = frame->samples[i].distance;
+    }
+
+    if (!(flags & CODEC_FLAG_CONSTANT_QUALITY))
+    {
+        uint16_t bytes = ((uint32_t) frame->count * CODEC_QUALITY_BITS + 7) / 8;
+        if (idx + bytes > size)
+        {
+            return 0;
+        }
+        memset(&buffer[idx], 0, bytes);
+        for (uint16_t i = 0; i < frame->count; i++)
+        {
+            uint32_t bit = (uint32_t) i * CODEC_QUALITY_BITS;
+            uint16_t value = (frame->samples[i].quality & CODEC_QUALITY_MASK) << (bit % 8);
+            buffer[idx + bit / 8] |= value & 0xFF;
+            if (value > 0xFF)
+            {
+                buffer[idx + bit / 8 + 1] |= value >> 8;
+            }
+        }
+        idx += bytes;
+    }
+
+    if (idx + CODEC_CRC_SIZE > size)
+    {
+        return 0;
+    }
+
+    buffer[0] = CODEC_SYNC;
+    buffer[1] = CODEC_VERSION;
+    buffer[2] = flags;
+    buffer[3] = quality;
+    _PutU16(&buffer[4], frame->count);
+    _PutU32(&buffer[6], frame->index);
+    _PutU32(&buffer[10], frame->start_timestamp);
+    _PutU32(&buffer[14], frame->end_timestamp - frame->start_timestamp);
+    _PutU16(&buffer[18], idx - CODEC_HEADER_SIZE);
+    _PutU16(&buffer[idx], CODEC_Crc16(buffer, idx, CODEC_CRC_INIT));
+    return idx + CODEC_CRC_SIZE;
+}
+
+uint16_t CODEC_DecodeSweep(const uint8_t *buffer, uint16_t length, sweep_frame_t *frame)
+{
+    if (length < CODEC_HEADER_SIZE + CODEC_CRC_SIZE || buffer[0] != CODEC_SYNC || buffer[1] != CODEC_VERSION)
+    {
+        return 0;
+    }
+
+    uint8_t flags = buffer[2];
+    uint16_t count = _GetU16(&buffer[4]);
+    uint32_t duration = _GetU32(&buffer[14]);
+    uint32_t end = (uint32_t) CODEC_HEADER_SIZE + _GetU16(&buffer[18]);
+    if (end + CODEC_CRC_SIZE > length || count > SWEEP_SAMPLES_MAX
+            || _GetU16(&buffer[end]) != CODEC_Crc16(buffer, end, CODEC_CRC_INIT))
+    {
+        return 0;
+    }
+
+    frame->index = _GetU32(&buffer[6]);
+    frame->start_timestamp = _GetU32(&buffer[10]);
+    frame->end_timestamp = frame->start_timestamp + duration;
+    frame->count = count;
+    frame->truncated = flags & CODEC_FLAG_TRUNCATED;
+    frame->decimated = 0; // Not encoded, the sweep is already decimated
+
+    uint16_t idx = CODEC_HEADER_SIZE;
+    int32_t angle = 0;
+    int32_t distance = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        int32_t delta_angle;
+        int32_t delta_distance;
+        idx = _GetVarint(buffer, idx, end, &delta_angle);
+        idx = _GetVarint(buffer, idx, end, &delta_distance);
+        if (idx == 0)
+        {
+            return 0;
+        }
+        angle += delta_angle;
+        distance += delta_distance;
+
+        sweep_sample_t *sample = &frame->samples[i];
+        sample->angle = angle;
+        sample->distance = distance;
+        sample->quality = buffer[3];
+        sample->timestamp = frame->start_timestamp
+                + (count > 1 ? (uint32_t) (((uint64_t) duration * i) / (count - 1)) : 0);
+    }
+
+    if (!(flags & CODEC_FLAG_CONSTANT_QUALITY))
+    {
+        if (idx + ((uint32_t) count * CODEC_QUALITY_BITS + 7) / 8 > end)
+        {
+            return 0;
+        }
+        for (uint16_t i = 0; i < count; i++)
+        {
+            uint32_t bit = (uint32_t) i * CODEC_QUALITY_BITS;
+            uint16_t value = buffer[idx + bit / 8];
+            if (bit % 8 > 8 - CODEC_QUALITY_BITS)
+            {
+                value |= buffer[idx + bit / 8 + 1] << 8;
+            }
+            frame->samples[i].quality = (value >> (bit % 8)) & CODEC_QUALITY_MASK;
+        }
+    }
+    return end + CODEC_CRC_SIZE;
+}
+
+uint16_t CODEC_DecodeStream(const uint8_t *buffer, uint16_t length, sweep_frame_t *frame, bool *found)
+{
+    uint16_t idx = 0;
+
+    *found = false;
+    while (idx < length)
+    {
+        if (buffer[idx] != CODEC_SYNC)
+        {
+            idx++;
+            continue;
+        }
+
+        uint16_t available = length - idx;
+        if (available >= CODEC_HEADER_SIZE
+                && (buffer[idx + 1] != CODEC_VERSION || _GetU16(&buffer[idx + 4]) > SWEEP_SAMPLES_MAX
+                        || _GetU16(&buffer[idx + 18]) > CODEC_SWEEP_SIZE_MAX(SWEEP_SAMPLES_MAX)))
+        {
+            // Sync byte found in the data, a real header cannot make us wait for more than one sweep
+            idx++;
+            continue;
+        }
+        if (available < CODEC_HEADER_SIZE
+                || available < CODEC_HEADER_SIZE + _GetU16(&buffer[idx + 18]) + (uint32_t) CODEC_CRC_SIZE)
+        {
+            // Wait for the rest of the sweep
+            break;
+        }
+
+        uint16_t size = CODEC_DecodeSweep(&buffer[idx], available, frame);
+        if (size > 0)
+        {
+            *found = true;
+            return idx + size;
+        }
+        // Not the start of a sweep, or a corrupted one
+        idx++;
+    }
+    return idx;
+}
+
+uint16_t CODEC_Crc16(const uint8_t *data, uint16_t length, uint16_t crc)
+{
+    for (uint16_t i = 0; i < length; i++)
+    {
+        crc ^= (uint16_t) data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static uint16_t _PutVarint(uint8_t *buffer, uint16_t idx, int32_t value)
+{
+    // Zigzag, small negative values also get a short encoding
+    uint32_t zigzag = ((uint32_t) value << 1) ^ (uint32_t) (value >> 31);
+
+    while (zigzag >= 0x80)
+    {
+        buffer[idx++] = (zigzag & 0x7F) | 0x80;
+        zigzag >>= 7;
+    }
+    buffer[idx++] = zigzag;
+    return idx;
+}
+
+static uint16_t _GetVarint(const uint8_t *buffer, uint16_t idx, uint16_t end, int32_t *value)
+{
+    uint32_t zigzag = 0;
+
+    if (idx == 0)
+    {
+        // Previous read already failed
+        return 0;
+    }
+
+    for (uint8_t shift = 0; shift < 7 * CODEC_VARINT_MAX; shift += 7)
+    {
+        if (idx >= end)
+        {
+            return 0;
+        }
+        uint8_t byte = buffer[idx++];
+        zigzag |= (uint32_t) (byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            *value = (int32_t) (zigzag >> 1) ^ -(int32_t) (zigzag & 1);
+            return idx;
+        }
+    }
+    return 0;
+}
+
+static void _PutU16(uint8_t *buffer, uint16_t value)
+{
+    buffer[0] = value & 0xFF;
+    buffer[1] = value >> 8;
+}
+
+static void _PutU32(uint8_t *buffer, uint32_t value)
+{
+    _PutU16(&buffer[0], value & 0xFFFF);
+    _PutU16(&buffer[2], value >> 16);
+}
+
+static uint16_t _GetU16(const uint8_t *buffer)
+{
+    return buffer[0] | (buffer[1] << 8);
+}
+
+static uint32_t _GetU32(const uint8_t *buffer)
+{
+    return _GetU16(&buffer[0]) | ((uint32_t) _GetU16(&buffer[2]) << 16);
+}
@@ -15,12 +15,26 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <math.h>
 
 #include "diag.h"
 #include "menu.h"
 #include "rplidar.h"
 #include "ILI9488.h"
 #include "buzzer.h"
+#include "map.h"
+#include "motor.h"
+#include "profile.h"
+#include "segment.h"
+#include "room.h"
+#include "cluster.h"
+#include "filter.h"
+#include "match.h"
+#include "tile.h"
+#include "store.h"
+#include "export.h"
+#include "bridge.h"
+#include "record.h"
 
 #define DIAG_BUTTON_CLOSE_X (ILI9488_HEIGHT - 50)
 #define DIAG_BUTTON_CLOSE_Y 20
@@ -42,6 +56,56 @@
 #define DIAG_BUTTON_SAMPLE_W 101
 #define DIAG_BUTTON_SAMPLE_H 45
 
+#define DIAG_BUTTON_PROFILE_X 5
+#define DIAG_BUTTON_PROFILE_Y 70
+#define DIAG_BUTTON_PROFILE_W 80
+#define DIAG_BUTTON_PROFILE_H 45
+
+#define DIAG_BUTTON_LIVE_X 5
+#define DIAG_BUTTON_LIVE_Y 120
+#define DIAG_BUTTON_LIVE_W 80
+#define DIAG_BUTTON_LIVE_H 45
+
+#define DIAG_BUTTON_SPEED_X 5
+#define DIAG_BUTTON_SPEED_Y 170
+#define DIAG_BUTTON_SPEED_W 80
+#define DIAG_BUTTON_SPEED_H 45
+
+#define DIAG_BUTTON_VIEW_X 5
+#define DIAG_BUTTON_VIEW_Y 220
+#define DIAG_BUTTON_VIEW_W 80
+#define DIAG_BUTTON_VIEW_H 45
+
+#define DIAG_BUTTON_ROOM_X 5
+#define DIAG_BUTTON_ROOM_Y 270
+#define DIAG_BUTTON_ROOM_W 80
+#define DIAG_BUTTON_ROOM_H 45
+
+#define DIAG_BUTTON_FILTER_X 395
+#define DIAG_BUTTON_FILTER_Y 70
+#define DIAG_BUTTON_FILTER_W 80
+#define DIAG_BUTTON_FILTER_H 45
+
+#define DIAG_BUTTON_TRACK_X 395
+#define DIAG_BUTTON_TRACK_Y 120
+#define DIAG_BUTTON_TRACK_W 80
+#define DIAG_BUTTON_TRACK_H 45
+
+#define DIAG_BUTTON_EXPORT_X 395
+#define DIAG_BUTTON_EXPORT_Y 170
+#define DIAG_BUTTON_EXPORT_W 80
+#define DIAG_BUTTON_EXPORT_H 45
+
+#define DIAG_BUTTON_BRIDGE_X 395
+#define DIAG_BUTTON_BRIDGE_Y 220
+#define DIAG_BUTTON_BRIDGE_W 80
+#define DIAG_BUTTON_BRIDGE_H 45
+
+#define DIAG_BUTTON_RECORD_X 395
+#define DIAG_BUTTON_RECORD_Y 270
+#define DIAG_BUTTON_RECORD_W 80
+#define DIAG_BUTTON_RECORD_H 45
+
 #define DIAG_BOX_X 90
 #define DIAG_BOX_Y 115
 #define DIAG_BOX_W 300
@@ -50,15 +114,74 @@
 #define DIAG_BUTTON_DEBOUNCE_TIMER 1000
 #define DIAG_REQUEST_TIMEOUT 500
 
+#define DIAG_LIVE_REFRESH_PERIOD 250 // ms
+#define DIAG_LIVE_VALUE_X (DIAG_BOX_X + 150)
+#define DIAG_LIVE_VALUE_LEN 12
+#define DIAG_LIVE_LINK_BYTES_MAX (460800 / 10) // Byte/s at 460800 bauds with 8N1 framing
+#define DIAG_LIVE_LINK_SATURATION 90 // %
+
+typedef enum
+{
+    DIAG_LIVE_SAMPLES,
+    DIAG_LIVE_REVOLUTIONS,
+    DIAG_LIVE_RPM,
+    DIAG_LIVE_UART,
+    DIAG_LIVE_SPI,
+    DIAG_LIVE_QUEUE,
+    DIAG_LIVE_DROPPED,
+    DIAG_LIVE_ERRORS,
+    DIAG_LIVE_BOTTLENECK,
+    DIAG_LIVE_MAX
+} diag_live_row_e;
+
+static const char *const diag_live_labels[DIAG_LIVE_MAX] = {
+        [DIAG_LIVE_SAMPLES] = "SAMPLES/S",
+        [DIAG_LIVE_REVOLUTIONS] = "REV/S",
+        [DIAG_LIVE_RPM] = "MOTOR RPM",
+        [DIAG_LIVE_UART] = "UART B/S",
+        [DIAG_LIVE_SPI] = "SPI B/S",
+        [DIAG_LIVE_QUEUE] = "QUEUE",
+        [DIAG_LIVE_DROPPED] = "DROPPED",
+        [DIAG_LIVE_ERRORS] = "ERR PRS/CAP",
+        [DIAG_LIVE_BOTTLENECK] = "BOTTLENECK"};
+
+static bool diag_live_active = false;
+static bool diag_bridge_active = false;
+static bridge_stats_t diag_bridge_stats;
+static uint32_t diag_live_tick = 0;
+static rplidar_stats_t diag_live_rpl_stats;
+static uint32_t diag_live_spi_bytes = 0;
+static uint32_t diag_live_dropped = 0;
+static char diag_live_values[DIAG_LIVE_MAX][DIAG_LIVE_VALUE_LEN + 1];
+
 static void _TestHealth(void);
 static void _TestDevice(void);
 static void _TestRate(void);
+static void _ShowLive(void);
+static void _ShowSpeed(void);
+static void _ShowView(void);
+static void _ShowRoom(void);
+static void _DrawButtonFilter(void);
+static void _ShowTracking(void);
+static void _DrawButtonExport(void);
+static void _ShowExport(void);
+static void _DrawButtonBridge(void);
+static void _ShowBridge(void);
+static void _UpdateBridge(uint32_t elapsed);
+static void _DumpRecord(void);
+static void _UpdateLiveValue(diag_live_row_e row, const char *value);
+#if PROFILE_ENABLED
+static void _ShowProfile(void);
+#endif
 
 void DIAG_Show(void)
 {
+    diag_live_active = false;
+    diag_bridge_active = false;
+
     ILI9488_FillScreen(ORANGE);
     ILI9488_CString(0, 20, ILI9488_HEIGHT, 20, "DIAGNOSTICS", Font24, 1, WHITE, ORANGE);
-    ILI9488_DrawImage(DIAG_BUTTON_CLOSE_X, DIAG_BUTTON_CLOSE_Y, DIAG_BUTTON_CLOSE_W, DIAG_BUTTON_CLOSE_H, cross, sizeof(cross));
+    ILI9488_DrawCompressedImage(DIAG_BUTTON_CLOSE_X, DIAG_BUTTON_CLOSE_Y, &cross);
 
     ILI9488_CString(DIAG_BUTTON_HEALTH_X, DIAG_BUTTON_HEALTH_Y, DIAG_BUTTON_HEALTH_W + DIAG_BUTTON_HEALTH_X - 1,
     DIAG_BUTTON_HEALTH_Y + DIAG_BUTTON_HEALTH_H - 1,
@@ -72,6 +195,50 @@ void DIAG_Show(void)
     DIAG_BUTTON_SAMPLE_Y + DIAG_BUTTON_SAMPLE_H - 1,
                     "RATE", Font16, 1, WHITE, BLUE);
 
+    ILI9488_CString(DIAG_BUTTON_LIVE_X, DIAG_BUTTON_LIVE_Y, DIAG_BUTTON_LIVE_W + DIAG_BUTTON_LIVE_X - 1,
+    DIAG_BUTTON_LIVE_Y + DIAG_BUTTON_LIVE_H - 1,
+                    "LIVE", Font16, 1, WHITE, DD_CYAN);
+    ILI9488_DrawBorder(DIAG_BUTTON_LIVE_X, DIAG_BUTTON_LIVE_Y, DIAG_BUTTON_LIVE_W, DIAG_BUTTON_LIVE_H, 2, WHITE);
+
+    ILI9488_CString(DIAG_BUTTON_SPEED_X, DIAG_BUTTON_SPEED_Y, DIAG_BUTTON_SPEED_W + DIAG_BUTTON_SPEED_X - 1,
+    DIAG_BUTTON_SPEED_Y + DIAG_BUTTON_SPEED_H - 1,
+                    "SPEED", Font16, 1, WHITE, DD_GREEN);
+    ILI9488_DrawBorder(DIAG_BUTTON_SPEED_X, DIAG_BUTTON_SPEED_Y, DIAG_BUTTON_SPEED_W, DIAG_BUTTON_SPEED_H, 2, WHITE);
+
+    ILI9488_CString(DIAG_BUTTON_VIEW_X, DIAG_BUTTON_VIEW_Y, DIAG_BUTTON_VIEW_W + DIAG_BUTTON_VIEW_X - 1,
+    DIAG_BUTTON_VIEW_Y + DIAG_BUTTON_VIEW_H - 1,
+                    "VIEW", Font16, 1, WHITE, DD_BLUE);
+    ILI9488_DrawBorder(DIAG_BUTTON_VIEW_X, DIAG_BUTTON_VIEW_Y, DIAG_BUTTON_VIEW_W, DIAG_BUTTON_VIEW_H, 2, WHITE);
+
+    ILI9488_CString(DIAG_BUTTON_ROOM_X, DIAG_BUTTON_ROOM_Y, DIAG_BUTTON_ROOM_W + DIAG_BUTTON_ROOM_X - 1,
+    DIAG_BUTTON_ROOM_Y + DIAG_BUTTON_ROOM_H - 1,
+                    "ROOM", Font16, 1, WHITE, DD_MAGENTA);
+    ILI9488_DrawBorder(DIAG_BUTTON_ROOM_X, DIAG_BUTTON_ROOM_Y, DIAG_BUTTON_ROOM_W, DIAG_BUTTON_ROOM_H, 2, WHITE);
+
+    _DrawButtonFilter();
+
+    ILI9488_CString(DIAG_BUTTON_TRACK_X, DIAG_BUTTON_TRACK_Y, DIAG_BUTTON_TRACK_W + DIAG_BUTTON_TRACK_X - 1,
+    DIAG_BUTTON_TRACK_Y + DIAG_BUTTON_TRACK_H - 1,
+                    "TRACK", Font16, 1, WHITE, D_CYAN);
+    ILI9488_DrawBorder(DIAG_BUTTON_TRACK_X, DIAG_BUTTON_TRACK_Y, DIAG_BUTTON_TRACK_W, DIAG_BUTTON_TRACK_H, 2, WHITE);
+
+    _DrawButtonExport();
+    _DrawButtonBridge();
+
+    ILI9488_CString(DIAG_BUTTON_RECORD_X, DIAG_BUTTON_RECORD_Y, DIAG_BUTTON_RECORD_W + DIAG_BUTTON_RECORD_X - 1,
+    DIAG_BUTTON_RECORD_Y + DIAG_BUTTON_RECORD_H - 1,
+                    "REC", Font16, 1, WHITE, DD_RED);
+    ILI9488_DrawBorder(DIAG_BUTTON_RECORD_X, DIAG_BUTTON_RECORD_Y, DIAG_BUTTON_RECORD_W, DIAG_BUTTON_RECORD_H, 2,
+    WHITE);
+
+#if PROFILE_ENABLED
+    ILI9488_CString(DIAG_BUTTON_PROFILE_X, DIAG_BUTTON_PROFILE_Y, DIAG_BUTTON_PROFILE_W + DIAG_BUTTON_PROFILE_X - 1,
+    DIAG_BUTTON_PROFILE_Y + DIAG_BUTTON_PROFILE_H - 1,
+                    "PROF", Font16, 1, WHITE, MAGENTA);
+    ILI9488_DrawBorder(DIAG_BUTTON_PROFILE_X, DIAG_BUTTON_PROFILE_Y, DIAG_BUTTON_PROFILE_W, DIAG_BUTTON_PROFILE_H, 2,
+    WHITE);
+#endif
+
     ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, WHITE);
     ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
     WHITE);
@@ -95,6 +262,8 @@ void DIAG_Touch(uint16_t x, uint16_t y)
         tick_pressed = tick_cur;
         Buzzer_Play_Menu_Touch();
 
+        diag_live_active = false;
+        diag_bridge_active = false;
         _TestHealth();
     }
     else if (x >= DIAG_BUTTON_DEVICE_X && x < DIAG_BUTTON_DEVICE_X + DIAG_BUTTON_DEVICE_W && y >= DIAG_BUTTON_DEVICE_Y
@@ -108,6 +277,8 @@ void DIAG_Touch(uint16_t x, uint16_t y)
         tick_pressed = tick_cur;
         Buzzer_Play_Menu_Touch();
 
+        diag_live_active = false;
+        diag_bridge_active = false;
         _TestDevice();
     }
     else if (x >= DIAG_BUTTON_SAMPLE_X && x < DIAG_BUTTON_SAMPLE_X + DIAG_BUTTON_SAMPLE_W && y >= DIAG_BUTTON_SAMPLE_Y
@@ -121,8 +292,176 @@ void DIAG_Touch(uint16_t x, uint16_t y)
         tick_pressed = tick_cur;
         Buzzer_Play_Menu_Touch();
 
+        diag_live_active = false;
+        diag_bridge_active = false;
         _TestRate();
     }
+    else if (x >= DIAG_BUTTON_LIVE_X && x < DIAG_BUTTON_LIVE_X + DIAG_BUTTON_LIVE_W && y >= DIAG_BUTTON_LIVE_Y
+            && y < DIAG_BUTTON_LIVE_Y + DIAG_BUTTON_LIVE_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        _ShowLive();
+    }
+    else if (x >= DIAG_BUTTON_SPEED_X && x < DIAG_BUTTON_SPEED_X + DIAG_BUTTON_SPEED_W && y >= DIAG_BUTTON_SPEED_Y
+            && y < DIAG_BUTTON_SPEED_Y + DIAG_BUTTON_SPEED_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        // Each press selects the next operating point
+        MOTOR_SetProfile((MOTOR_GetProfile() + 1) % MOTOR_PROFILE_MAX);
+        diag_live_active = false;
+        diag_bridge_active = false;
+        _ShowSpeed();
+    }
+    else if (x >= DIAG_BUTTON_VIEW_X && x < DIAG_BUTTON_VIEW_X + DIAG_BUTTON_VIEW_W && y >= DIAG_BUTTON_VIEW_Y
+            && y < DIAG_BUTTON_VIEW_Y + DIAG_BUTTON_VIEW_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        // Each press selects the next map render mode
+        MAP_SetRenderMode((MAP_GetRenderMode() + 1) % MAP_RENDER_MAX);
+        diag_live_active = false;
+        diag_bridge_active = false;
+        _ShowView();
+    }
+    else if (x >= DIAG_BUTTON_ROOM_X && x < DIAG_BUTTON_ROOM_X + DIAG_BUTTON_ROOM_W && y >= DIAG_BUTTON_ROOM_Y
+            && y < DIAG_BUTTON_ROOM_Y + DIAG_BUTTON_ROOM_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        diag_live_active = false;
+        diag_bridge_active = false;
+        _ShowRoom();
+    }
+    else if (x >= DIAG_BUTTON_FILTER_X && x < DIAG_BUTTON_FILTER_X + DIAG_BUTTON_FILTER_W
+            && y >= DIAG_BUTTON_FILTER_Y && y < DIAG_BUTTON_FILTER_Y + DIAG_BUTTON_FILTER_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        // Toggle the temporal filter of the map ranges
+        FILTER_Enable(!FILTER_IsEnabled());
+        _DrawButtonFilter();
+    }
+    else if (x >= DIAG_BUTTON_TRACK_X && x < DIAG_BUTTON_TRACK_X + DIAG_BUTTON_TRACK_W && y >= DIAG_BUTTON_TRACK_Y
+            && y < DIAG_BUTTON_TRACK_Y + DIAG_BUTTON_TRACK_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        // Toggle handheld mapping, the map follows the sensor motion estimated between sweeps
+        MAP_SetTracking(!MAP_IsTracking());
+        diag_live_active = false;
+        diag_bridge_active = false;
+        _ShowTracking();
+    }
+    else if (x >= DIAG_BUTTON_EXPORT_X && x < DIAG_BUTTON_EXPORT_X + DIAG_BUTTON_EXPORT_W
+            && y >= DIAG_BUTTON_EXPORT_Y && y < DIAG_BUTTON_EXPORT_Y + DIAG_BUTTON_EXPORT_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        // Toggle the streaming of the sweeps to the host
+        // The sweeps and the raw bytes cannot share the link
+        EXPORT_Enable(!EXPORT_IsEnabled());
+        BRIDGE_Enable(false);
+        _DrawButtonExport();
+        _DrawButtonBridge();
+        diag_live_active = false;
+        diag_bridge_active = false;
+        _ShowExport();
+    }
+    else if (x >= DIAG_BUTTON_BRIDGE_X && x < DIAG_BUTTON_BRIDGE_X + DIAG_BUTTON_BRIDGE_W
+            && y >= DIAG_BUTTON_BRIDGE_Y && y < DIAG_BUTTON_BRIDGE_Y + DIAG_BUTTON_BRIDGE_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        // Toggle the forwarding of the raw lidar bytes to the host
+        BRIDGE_Enable(!BRIDGE_IsEnabled());
+        EXPORT_Enable(false);
+        _DrawButtonBridge();
+        _DrawButtonExport();
+        diag_live_active = false;
+        _ShowBridge();
+    }
+    else if (x >= DIAG_BUTTON_RECORD_X && x < DIAG_BUTTON_RECORD_X + DIAG_BUTTON_RECORD_W
+            && y >= DIAG_BUTTON_RECORD_Y && y < DIAG_BUTTON_RECORD_Y + DIAG_BUTTON_RECORD_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        diag_live_active = false;
+        diag_bridge_active = false;
+        _DumpRecord();
+    }
+#if PROFILE_ENABLED
+    else if (x >= DIAG_BUTTON_PROFILE_X && x < DIAG_BUTTON_PROFILE_X + DIAG_BUTTON_PROFILE_W
+            && y >= DIAG_BUTTON_PROFILE_Y && y < DIAG_BUTTON_PROFILE_Y + DIAG_BUTTON_PROFILE_H)
+    {
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < DIAG_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        diag_live_active = false;
+        diag_bridge_active = false;
+        _ShowProfile();
+    }
+#endif
     else if (x >= DIAG_BUTTON_CLOSE_X && x < DIAG_BUTTON_CLOSE_X + DIAG_BUTTON_CLOSE_W && y >= DIAG_BUTTON_CLOSE_Y
             && y < DIAG_BUTTON_CLOSE_Y + DIAG_BUTTON_CLOSE_H)
     {
@@ -134,10 +473,78 @@ void DIAG_Touch(uint16_t x, uint16_t y)
         tick_pressed = tick_cur;
         Buzzer_Play_Menu_Out();
 
+        diag_live_active = false;
+        diag_bridge_active = false;
         MENU_SetScreen(MENU_SCREEN_MAIN);
     }
 }
 
+void DIAG_Update(void)
+{
+    rplidar_stats_t rpl_stats;
+    map_stats_t map_stats;
+    char str[DIAG_LIVE_VALUE_LEN + 1];
+    uint32_t tick_cur = HAL_GetTick();
+    uint32_t elapsed = tick_cur - diag_live_tick;
+
+    if (diag_bridge_active && elapsed >= DIAG_LIVE_REFRESH_PERIOD)
+    {
+        _UpdateBridge(elapsed);
+        diag_live_tick = tick_cur;
+        return;
+    }
+    if (!diag_live_active || elapsed < DIAG_LIVE_REFRESH_PERIOD)
+    {
+        return;
+    }
+
+    RPLIDAR_GetStats(&rpl_stats);
+    MAP_GetStats(&map_stats);
+    uint32_t spi_bytes = ILI9488_GetBytesSent();
+
+    uint32_t samples = (rpl_stats.measurements - diag_live_rpl_stats.measurements) * 1000 / elapsed;
+    uint32_t revolutions = rpl_stats.revolutions - diag_live_rpl_stats.revolutions;
+    uint32_t uart = (rpl_stats.rx_bytes - diag_live_rpl_stats.rx_bytes) * 1000 / elapsed;
+    uint32_t spi = (spi_bytes - diag_live_spi_bytes) * 1000 / elapsed;
+    uint32_t dropped = map_stats.sample_dropped - diag_live_dropped;
+
+    snprintf(str, sizeof(str), "%lu", samples);
+    _UpdateLiveValue(DIAG_LIVE_SAMPLES, str);
+    snprintf(str, sizeof(str), "%lu.%lu", revolutions * 1000 / elapsed, (revolutions * 10000 / elapsed) % 10);
+    _UpdateLiveValue(DIAG_LIVE_REVOLUTIONS, str);
+    snprintf(str, sizeof(str), "%lu", revolutions * 60000 / elapsed);
+    _UpdateLiveValue(DIAG_LIVE_RPM, str);
+    snprintf(str, sizeof(str), "%lu", uart);
+    _UpdateLiveValue(DIAG_LIVE_UART, str);
+    snprintf(str, sizeof(str), "%lu", spi);
+    _UpdateLiveValue(DIAG_LIVE_SPI, str);
+    snprintf(str, sizeof(str), "%hu/%hu", map_stats.sample_count, map_stats.sample_capacity);
+    _UpdateLiveValue(DIAG_LIVE_QUEUE, str);
+    snprintf(str, sizeof(str), "%lu", map_stats.sample_dropped);
+    _UpdateLiveValue(DIAG_LIVE_DROPPED, str);
+    snprintf(str, sizeof(str), "%lu/%lu", rpl_stats.parse_errors, rpl_stats.capsule_errors);
+    _UpdateLiveValue(DIAG_LIVE_ERRORS, str);
+
+    if (dropped > 0 || map_stats.sample_count > map_stats.sample_capacity / 2)
+    {
+        // Samples are produced faster than the map draws them
+        _UpdateLiveValue(DIAG_LIVE_BOTTLENECK, "DISPLAY");
+    }
+    else if (uart * 100 > DIAG_LIVE_LINK_BYTES_MAX * DIAG_LIVE_LINK_SATURATION)
+    {
+        _UpdateLiveValue(DIAG_LIVE_BOTTLENECK, "SENSOR LINK");
+    }
+    else
+    {
+        _UpdateLiveValue(DIAG_LIVE_BOTTLENECK, "NONE");
+    }
+
+    diag_live_rpl_stats = rpl_stats;
+    diag_live_spi_bytes = spi_bytes;
+    diag_live_dropped = map_stats.sample_dropped;
+    diag_live_tick = tick_cur;
+}
+
 static void _TestHealth(void)
 {
     rplidar_health_t health;
@@ -215,6 +622,15 @@ static void _TestRate(void)
         ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 30, str, Font16, 1, WHITE, BLUE);
         snprintf(str, sizeof(str), "EXPRESS RATE :  %hu", rate.texpress);
         ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 50, str, Font16, 1, WHITE, BLUE);
+
+        const rplidar_scan_mode_t *mode = RPLIDAR_GetSelectedScanMode();
+        if (mode != NULL)
+        {
+            snprintf(str, sizeof(str), "SCAN MODE :     %s", mode->name);
+            ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 80, str, Font16, 1, WHITE, BLUE);
+            snprintf(str, sizeof(str), "SAMPLE TIME :   %lu us", mode->us_per_sample >> 8);
+            ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 100, str, Font16, 1, WHITE, BLUE);
+        }
     }
     else
     {
@@ -222,3 +638,323 @@ static void _TestRate(void)
                         "ERROR : No response", Font16, 1, WHITE, BLUE);
     }
 }
+
+static void _ShowLive(void)
+{
+    ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, DD_CYAN);
+    ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
+    WHITE);
+
+    // Labels are drawn once, only values are redrawn when they change
+    for (uint8_t i = 0; i < DIAG_LIVE_MAX; i++)
+    {
+        ILI9488_WString(DIAG_BOX_X + 10, DIAG_BOX_Y + 3 + 16 * i, diag_live_labels[i], Font16, 1, WHITE, DD_CYAN);
+        diag_live_values[i][0] = '\0';
+    }
+
+    RPLIDAR_GetStats(&diag_live_rpl_stats);
+    diag_live_spi_bytes = ILI9488_GetBytesSent();
+    map_stats_t map_stats;
+    MAP_GetStats(&map_stats);
+    diag_live_dropped = map_stats.sample_dropped;
+    diag_live_tick = HAL_GetTick();
+    diag_live_active = true;
+}
+
+static void _ShowSpeed(void)
+{
+    char str[64];
+    const char *profile = NULL;
+
+    switch (MOTOR_GetProfile())
+    {
+        default:
+        case MOTOR_PROFILE_DENSE:
+            profile = "DENSE";
+            break;
+        case MOTOR_PROFILE_BALANCED:
+            profile = "BALANCED";
+            break;
+        case MOTOR_PROFILE_FAST:
+            profile = "FAST";
+            break;
+    }
+
+    ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, DD_GREEN);
+    ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
+    WHITE);
+
+    snprintf(str, sizeof(str), "PROFILE :    %s", profile);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 30, str, Font16, 1, WHITE, DD_GREEN);
+    snprintf(str, sizeof(str), "TARGET :     %hu rpm", MOTOR_GetTargetRpm());
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 50, str, Font16, 1, WHITE, DD_GREEN);
+    snprintf(str, sizeof(str), "MEASURED :   %hu rpm", MOTOR_GetMeasuredRpm());
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 70, str, Font16, 1, WHITE, DD_GREEN);
+    snprintf(str, sizeof(str), "RESOLUTION : %hu mdeg", MOTOR_GetAngularResolution());
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 90, str, Font16, 1, WHITE, DD_GREEN);
+}
+
+static void _ShowView(void)
+{
+    char str[64];
+    uint8_t count;
+    cluster_stats_t cluster_stats;
+    map_stats_t map_stats;
+    const char *mode = NULL;
+
+    switch (MAP_GetRenderMode())
+    {
+        default:
+        case MAP_RENDER_POINTS:
+            mode = "POINTS";
+            break;
+        case MAP_RENDER_LINES:
+            mode = "LINES";
+            break;
+        case MAP_RENDER_HEATMAP:
+            mode = "HEATMAP";
+            break;
+    }
+    SEGMENT_GetSegments(&count);
+    CLUSTER_GetStats(&cluster_stats);
+    MAP_GetStats(&map_stats);
+
+    ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, DD_BLUE);
+    ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
+    WHITE);
+
+    snprintf(str, sizeof(str), "RENDER :   %s", mode);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 30, str, Font16, 1, WHITE, DD_BLUE);
+    snprintf(str, sizeof(str), "SEGMENTS : %hu", count);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 50, str, Font16, 1, WHITE, DD_BLUE);
+    snprintf(str, sizeof(str), "CLUSTERS : %lu", cluster_stats.clusters);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 70, str, Font16, 1, WHITE, DD_BLUE);
+    snprintf(str, sizeof(str), "OUTLIERS : %lu/%lu", cluster_stats.rejected, cluster_stats.processed);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 90, str, Font16, 1, WHITE, DD_BLUE);
+    snprintf(str, sizeof(str), "CELLS :    %hu (%lu lost)", map_stats.cells_updated, map_stats.cells_dropped);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 110, str, Font16, 1, WHITE, DD_BLUE);
+}
+
+/* Show the last room estimate computed while mapping */
+static void _ShowRoom(void)
+{
+    char str[64];
+    const room_t *room = ROOM_Get();
+
+    ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, DD_MAGENTA);
+    ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
+    WHITE);
+
+    if (room == NULL)
+    {
+        ILI9488_CString(DIAG_BOX_X + 1, DIAG_BOX_Y, DIAG_BOX_X + DIAG_BOX_W - 1, DIAG_BOX_Y + DIAG_BOX_H,
+                        "No room estimated yet", Font16, 1, WHITE, DD_MAGENTA);
+        return;
+    }
+
+    snprintf(str, sizeof(str), "WIDTH %u mm  DEPTH %u mm", room->width, room->depth);
+    ILI9488_WString(DIAG_BOX_X + 10, DIAG_BOX_Y + 5, str, Font12, 1, WHITE, DD_MAGENTA);
+    snprintf(str, sizeof(str), "AREA %lu.%02lu m2  WALLS %hu", room->area / 10000, (room->area % 10000) / 100,
+             room->wall_count);
+    ILI9488_WString(DIAG_BOX_X + 10, DIAG_BOX_Y + 20, str, Font12, 1, WHITE, DD_MAGENTA);
+    for (uint8_t i = 0; i < room->wall_count; i++)
+    {
+        snprintf(str, sizeof(str), "WALL %hu : %u mm", i + 1, room->walls[i].length);
+        ILI9488_WString(DIAG_BOX_X + 10, DIAG_BOX_Y + 38 + 13 * i, str, Font12, 1, WHITE, DD_MAGENTA);
+    }
+}
+
+static void _ShowTracking(void)
+{
+    char str[64];
+    match_pose_t pose;
+    match_stats_t stats;
+    tile_stats_t tiles;
+    store_stats_t store;
+
+    MATCH_GetPose(&pose);
+    MATCH_GetStats(&stats);
+    TILE_GetStats(&tiles);
+    STORE_GetStats(&store);
+
+    ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, D_CYAN);
+    ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
+    WHITE);
+
+    snprintf(str, sizeof(str), "TRACKING :  %s", MAP_IsTracking() ? "ON" : "OFF");
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 20, str, Font16, 1, WHITE, D_CYAN);
+    snprintf(str, sizeof(str), "POSE : %ld %ld mm %ld deg", (int32_t) pose.x, (int32_t) pose.y,
+             (int32_t) (pose.theta * 180 / M_PI));
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 45, str, Font12, 1, WHITE, D_CYAN);
+    snprintf(str, sizeof(str), "MATCHED : %lu  FAILED : %lu", stats.matched, stats.failed);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 65, str, Font12, 1, WHITE, D_CYAN);
+    snprintf(str, sizeof(str), "KEYFRAMES : %lu  FLASH : %lu/%luK", stats.keyframes, store.used / 1024,
+             store.size / 1024);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 85, str, Font12, 1, WHITE, D_CYAN);
+    snprintf(str, sizeof(str), "INLIERS : %hu  ITERATIONS : %hu", stats.inliers, stats.iterations);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 105, str, Font12, 1, WHITE, D_CYAN);
+    snprintf(str, sizeof(str), "TILES : %u/%u  OUT : %lu  LOST : %lu", tiles.resident, TILE_SLOTS, tiles.written,
+             tiles.dropped);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 125, str, Font12, 1, WHITE, D_CYAN);
+}
+
+static void _DrawButtonFilter(void)
+{
+    bool enabled = FILTER_IsEnabled();
+
+    ILI9488_CString(DIAG_BUTTON_FILTER_X, DIAG_BUTTON_FILTER_Y, DIAG_BUTTON_FILTER_W + DIAG_BUTTON_FILTER_X - 1,
+    DIAG_BUTTON_FILTER_Y + DIAG_BUTTON_FILTER_H - 1,
+                    enabled ? "FLT ON" : "FLT OFF", Font16, 1, WHITE, enabled ? DD_GREEN : DD_RED);
+    ILI9488_DrawBorder(DIAG_BUTTON_FILTER_X, DIAG_BUTTON_FILTER_Y, DIAG_BUTTON_FILTER_W, DIAG_BUTTON_FILTER_H, 2,
+    WHITE);
+}
+
+static void _DrawButtonExport(void)
+{
+    bool enabled = EXPORT_IsEnabled();
+
+    ILI9488_CString(DIAG_BUTTON_EXPORT_X, DIAG_BUTTON_EXPORT_Y, DIAG_BUTTON_EXPORT_W + DIAG_BUTTON_EXPORT_X - 1,
+    DIAG_BUTTON_EXPORT_Y + DIAG_BUTTON_EXPORT_H - 1,
+                    enabled ? "USB ON" : "USB OFF", Font16, 1, WHITE, enabled ? DD_GREEN : DD_RED);
+    ILI9488_DrawBorder(DIAG_BUTTON_EXPORT_X, DIAG_BUTTON_EXPORT_Y, DIAG_BUTTON_EXPORT_W, DIAG_BUTTON_EXPORT_H, 2,
+    WHITE);
+}
+
+static void _ShowExport(void)
+{
+    char str[64];
+    export_stats_t stats;
+
+    EXPORT_GetStats(&stats);
+
+    ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, DD_GREEN);
+    ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
+    WHITE);
+
+    snprintf(str, sizeof(str), "EXPORT :  %s", EXPORT_IsEnabled() ? "ON" : "OFF");
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 20, str, Font16, 1, WHITE, DD_GREEN);
+    snprintf(str, sizeof(str), "SWEEPS : %lu", stats.sweeps);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 50, str, Font16, 1, WHITE, DD_GREEN);
+    snprintf(str, sizeof(str), "DROPPED : %lu", stats.dropped);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 75, str, Font16, 1, WHITE, DD_GREEN);
+    snprintf(str, sizeof(str), "SENT : %lu KB", stats.bytes / 1024);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 100, str, Font16, 1, WHITE, DD_GREEN);
+}
+
+static void _DrawButtonBridge(void)
+{
+    bool enabled = BRIDGE_IsEnabled();
+
+    ILI9488_CString(DIAG_BUTTON_BRIDGE_X, DIAG_BUTTON_BRIDGE_Y, DIAG_BUTTON_BRIDGE_W + DIAG_BUTTON_BRIDGE_X - 1,
+    DIAG_BUTTON_BRIDGE_Y + DIAG_BUTTON_BRIDGE_H - 1,
+                    enabled ? "RAW ON" : "RAW OFF", Font16, 1, WHITE, enabled ? DD_GREEN : DD_RED);
+    ILI9488_DrawBorder(DIAG_BUTTON_BRIDGE_X, DIAG_BUTTON_BRIDGE_Y, DIAG_BUTTON_BRIDGE_W, DIAG_BUTTON_BRIDGE_H, 2,
+    WHITE);
+}
+
+static void _ShowBridge(void)
+{
+    ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, DD_GREEN);
+    ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
+    WHITE);
+
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 20, BRIDGE_IsEnabled() ? "BRIDGE :  ON" : "BRIDGE :  OFF", Font16, 1,
+    WHITE, DD_GREEN);
+
+    // Values are refreshed periodically by DIAG_Update while the bridge runs
+    BRIDGE_GetStats(&diag_bridge_stats);
+    diag_live_tick = HAL_GetTick();
+    diag_bridge_active = BRIDGE_IsEnabled();
+    _UpdateBridge(0);
+}
+
+static void _UpdateBridge(uint32_t elapsed)
+{
+    char str[64];
+    bridge_stats_t stats;
+
+    BRIDGE_GetStats(&stats);
+    uint32_t rate = elapsed > 0 ? (stats.bytes - diag_bridge_stats.bytes) * 1000 / elapsed : 0;
+
+    // Pad with spaces to erase the previous value without clearing the area first
+    snprintf(str, sizeof(str), "RATE : %-8lu B/S", rate);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 50, str, Font16, 1, WHITE, DD_GREEN);
+    snprintf(str, sizeof(str), "SENT : %-8lu KB", stats.bytes / 1024);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 75, str, Font16, 1, WHITE, DD_GREEN);
+    snprintf(str, sizeof(str), "DROPPED : %-8lu B", stats.dropped);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 100, str, Font16, 1, WHITE, DD_GREEN);
+
+    diag_bridge_stats = stats;
+}
+
+static void _DumpRecord(void)
+{
+    char str[64];
+    record_stats_t stats;
+
+    // Stats of the ring being dumped, it restarts empty afterwards
+    RECORD_GetStats(&stats);
+
+    ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, DD_RED);
+    ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
+    WHITE);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 20, "DUMPING...", Font16, 1, WHITE, DD_RED);
+
+    bool dumped = RECORD_Dump();
+    // The link is free unless the sweeps or the raw bytes are streamed
+    bool sent = dumped && !EXPORT_IsEnabled() && !BRIDGE_IsEnabled() && RECORD_Send();
+
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 20, dumped ? "DUMP :  OK  " : "DUMP :  FAIL", Font16, 1, WHITE,
+    DD_RED);
+    snprintf(str, sizeof(str), "ENTRIES : %hu", stats.entries);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 50, str, Font16, 1, WHITE, DD_RED);
+    snprintf(str, sizeof(str), "BYTES : %hu", stats.used);
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 75, str, Font16, 1, WHITE, DD_RED);
+    // Only the end of the scan is kept, the time covered depends on the data rate of the scan mode
+    snprintf(str, sizeof(str), "LAST %lu MS BEFORE DUMP", stats.span / (SystemCoreClock / 1000));
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 100, str, Font16, 1, WHITE, DD_RED);
+    snprintf(str, sizeof(str), "HOST : %s", sent ? "SENDING" : "NOT SENT");
+    ILI9488_WString(DIAG_BOX_X + 20, DIAG_BOX_Y + 125, str, Font16, 1, WHITE, DD_RED);
+}
+
+static void _UpdateLiveValue(diag_live_row_e row, const char *value)
+{
+    char str[DIAG_LIVE_VALUE_LEN + 1];
+
+    if (strncmp(diag_live_values[row], value, DIAG_LIVE_VALUE_LEN) == 0)
+    {
+        return;
+    }
+    strncpy(diag_live_values[row], value, DIAG_LIVE_VALUE_LEN);
+    diag_live_values[row][DIAG_LIVE_VALUE_LEN] = '\0';
+
+    // Pad with spaces to erase the previous value without clearing the area first
+    snprintf(str, sizeof(str), "%-*s", DIAG_LIVE_VALUE_LEN, value);
+    ILI9488_WString(DIAG_LIVE_VALUE_X, DIAG_BOX_Y + 3 + 16 * row, str, Font16, 1, YELLOW, DD_CYAN);
+}
+
+#if PROFILE_ENABLED
+/* Show statistics accumulated since the previous press, then restart the measurement window */
+static void _ShowProfile(void)
+{
+    profile_stats_t stats;
+    char str[64];
+
+    ILI9488_FillArea(DIAG_BOX_X, DIAG_BOX_Y, DIAG_BOX_W, DIAG_BOX_H, MAGENTA);
+    ILI9488_DrawBorder(DIAG_BOX_X, DIAG_BOX_Y - DIAG_BUTTON_SAMPLE_H, DIAG_BOX_W, DIAG_BOX_H + DIAG_BUTTON_SAMPLE_H, 2,
+    WHITE);
+
+    snprintf(str, sizeof(str), "CPU LOAD : %hu %%", PROFILE_GetCpuLoad());
+    ILI9488_WString(DIAG_BOX_X + 10, DIAG_BOX_Y + 10, str, Font16, 1, WHITE, MAGENTA);
+    ILI9488_WString(DIAG_BOX_X + 10, DIAG_BOX_Y + 35, "ZONE         MIN    AVG    MAX  COUNT", Font12, 1, WHITE,
+    MAGENTA);
+
+    for (uint8_t i = 0; i < PROFILE_ZONE_MAX; i++)
+    {
+        PROFILE_GetStats(i, &stats, true);
+        snprintf(str, sizeof(str), "%-9s %6lu %6lu %6lu %6lu", PROFILE_GetZoneName(i), stats.min,
+                 stats.count ? (uint32_t) (stats.total / stats.count) : 0, stats.max, stats.count);
+        ILI9488_WString(DIAG_BOX_X + 10, DIAG_BOX_Y + 52 + 16 * i, str, Font12, 1, WHITE, MAGENTA);
+    }
+}
+#endif
@@ -0,0 +1,108 @@
+/*
+ * export.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "export.h"
+#include "codec.h"
+#include "link.h"
+
+// Double buffered, one buffer is filled while the link sends the other one
+static uint8_t export_buffers[2][EXPORT_BUFFER_SIZE];
+static uint8_t export_fill = 0;
+static uint16_t export_fill_length = 0;
+static uint16_t export_fill_sweeps = 0;
+static bool export_enabled = false;
+static uint32_t export_sweeps = 0;
+static uint32_t export_dropped = 0;
+static uint32_t export_bytes = 0;
+
+static bool _Flush(void);
+
+void EXPORT_Enable(bool enable)
+{
+    if (enable && !export_enabled)
+    {
+        // New streaming session
+        export_sweeps = 0;
+        export_dropped = 0;
+        export_bytes = 0;
+    }
+    export_enabled = enable;
+    export_fill_length = 0;
+    export_fill_sweeps = 0;
+}
+
+bool EXPORT_IsEnabled(void)
+{
+    return export_enabled;
+}
+
+void EXPORT_AddSweep(const sweep_frame_t *frame)
+{
+    if (!export_enabled || frame == NULL)
+    {
+        return;
+    }
+
+    uint16_t length = CODEC_EncodeSweep(frame, &export_buffers[export_fill][export_fill_length],
+    EXPORT_BUFFER_SIZE - export_fill_length);
+    if (length == 0 && export_fill_length > 0 && _Flush())
+    {
+        // Buffer was full, retry in the empty one
+        length = CODEC_EncodeSweep(frame, export_buffers[export_fill], EXPORT_BUFFER_SIZE);
+    }
+    if (length == 0)
+    {
+        export_dropped++;
+        return;
+    }
+    export_fill_length += length;
+    export_fill_sweeps++;
+
+    // Send right away if the link is idle, to keep the latency at one sweep
+    _Flush();
+}
+
+void EXPORT_Update(void)
+{
+    if (export_enabled)
+    {
+        _Flush();
+    }
+}
+
+void EXPORT_GetStats(export_stats_t *stats)
+{
+    stats->sweeps = export_sweeps;
+    stats->dropped = export_dropped;
+    stats->bytes = export_bytes;
+}
+
+static bool _Flush(void)
+{
+    if (export_fill_length == 0 || LINK_IsBusy())
+    {
+        return false;
+    }
+
+    if (LINK_Transmit(export_buffers[export_fill], export_fill_length))
+    {
+        export_sweeps += export_fill_sweeps;
+        export_bytes += export_fill_length;
+        export_fill ^= 1;
+    }
+    else
+    {
+        // No host connected
+        export_dropped += export_fill_sweeps;
+    }
+    export_fill_length = 0;
+    export_fill_sweeps = 0;
+    return true;
+}
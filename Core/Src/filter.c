@@ -0,0 +1,68 @@
+/*
+ * filter.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "filter.h"
+
+#define FILTER_RESET_DISTANCE (200 << 2) // Q2, range jump restarting the average
+
+static bool filter_enabled = false;
+static uint16_t filter_range[FILTER_BINS];
+
+void FILTER_Reset(void)
+{
+    memset(filter_range, 0, sizeof(filter_range));
+}
+
+void FILTER_Enable(bool enable)
+{
+    if (enable && !filter_enabled)
+    {
+        FILTER_Reset();
+    }
+    filter_enabled = enable;
+}
+
+bool FILTER_IsEnabled(void)
+{
+    return filter_enabled;
+}
+
+void FILTER_Apply(rplidar_measurement_t *measurement)
+{
+    uint16_t bin = ((uint32_t) measurement->angle * FILTER_BINS) / (360 * 64);
+
+    if (!filter_enabled || bin >= FILTER_BINS)
+    {
+        return;
+    }
+
+    uint16_t range = filter_range[bin];
+    int32_t error = (int32_t) measurement->distance - range;
+
+    // Noise grows with the range, allow 1/16 of it on top of the fixed threshold
+    if (range == 0 || error > FILTER_RESET_DISTANCE + (range >> 4) || -error > FILTER_RESET_DISTANCE + (range >> 4))
+    {
+        range = measurement->distance;
+    }
+    else
+    {
+        // Q8 gain from 1/256 to 1/2, a low quality sample barely moves the average
+        uint32_t alpha = (measurement->quality << 1) + 1;
+        range += (error * (int32_t) alpha) / 256;
+    }
+
+    filter_range[bin] = range;
+    measurement->distance = range;
+}
+
+const uint16_t* FILTER_GetProfile(void)
+{
+    return filter_range;
+}
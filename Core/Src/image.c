@@ -0,0 +1,74 @@
+/*
+ * image.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "image.h"
+
+#define IMAGE_PIXEL_SIZE 3
+
+static bool _ReadIndex(image_decoder_t *decoder, uint8_t *index);
+
+void IMAGE_Start(image_decoder_t *decoder, const image_t *image)
+{
+    decoder->image = image;
+    decoder->idx = 0;
+    decoder->remaining = 0;
+    decoder->color = 0;
+    decoder->literal = false;
+}
+
+uint16_t IMAGE_Decode(image_decoder_t *decoder, uint8_t *buffer, uint16_t size)
+{
+    const image_t *image = decoder->image;
+    uint16_t written = 0;
+
+    while (written + IMAGE_PIXEL_SIZE <= size)
+    {
+        if (decoder->remaining == 0)
+        {
+            if (decoder->idx >= image->size)
+            {
+                // Image complete
+                break;
+            }
+            uint8_t token = image->data[decoder->idx++];
+            decoder->literal = !(token & IMAGE_TOKEN_RUN);
+            decoder->remaining = (token & ~IMAGE_TOKEN_RUN) + 1;
+            if (!decoder->literal && !_ReadIndex(decoder, &decoder->color))
+            {
+                return 0;
+            }
+        }
+
+        uint8_t index = decoder->color;
+        if (decoder->literal && !_ReadIndex(decoder, &index))
+        {
+            return 0;
+        }
+        memcpy(&buffer[written], &image->palette[index * IMAGE_PIXEL_SIZE], IMAGE_PIXEL_SIZE);
+        written += IMAGE_PIXEL_SIZE;
+        decoder->remaining--;
+    }
+    return written;
+}
+
+static bool _ReadIndex(image_decoder_t *decoder, uint8_t *index)
+{
+    const image_t *image = decoder->image;
+
+    if (decoder->idx >= image->size || image->data[decoder->idx] >= image->colors)
+    {
+        // Truncated or corrupted tokens, stop instead of reading outside of the image
+        decoder->idx = image->size;
+        decoder->remaining = 0;
+        return false;
+    }
+    *index = image->data[decoder->idx++];
+    return true;
+}
@@ -0,0 +1,46 @@
+/*
+ * link.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "link.h"
+
+static volatile bool link_busy = false;
+
+bool LINK_Transmit(const uint8_t *data, uint16_t length)
+{
+    if (link_busy || length == 0)
+    {
+        return false;
+    }
+
+    // Busy before starting, the transport may complete from its interrupt before returning
+    link_busy = true;
+    if (!LINK_Send(data, length))
+    {
+        link_busy = false;
+        return false;
+    }
+    return true;
+}
+
+bool LINK_IsBusy(void)
+{
+    return link_busy;
+}
+
+void LINK_TransmitComplete(void)
+{
+    link_busy = false;
+}
+
+__attribute__((weak)) bool LINK_Send(const uint8_t *data, uint16_t length)
+{
+    (void) data;
+    (void) length;
+    return false;
+}
@@ -1,887 +1,160 @@
 /*
  * logo.c
  *
- *  Created on: 8 déc. 2025
- *      Author: nicob
+ *  Generated by tools/image2c.py from assets/logo.ppm, assets/cross.ppm, assets/volume.ppm, do not edit.
  */
-#include "menu.h"
 
-const uint8_t logo[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x20,
-        0x20, 0x20, 0x33, 0x33, 0x33, 0x3b, 0x3b, 0x3b, 0x44, 0x44, 0x44, 0x4e, 0x4e, 0x4e, 0x55, 0x55, 0x55, 0x62,
-        0x62, 0x62, 0x62, 0x62, 0x62, 0x55, 0x55, 0x55, 0x4e, 0x4e, 0x4e, 0x44, 0x44, 0x44, 0x3b, 0x3b, 0x3b, 0x33,
-        0x33, 0x33, 0x20, 0x20, 0x20, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x79, 0x79, 0x79, 0xa1,
-        0xa1, 0xa1, 0xc1, 0xc1, 0xc1, 0xe1, 0xe1, 0xe1, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-        0xfb, 0xfb, 0xe0, 0xe0, 0xe0, 0xc1, 0xc1, 0xc1, 0xa1, 0xa1, 0xa1, 0x78, 0x78, 0x78, 0x40, 0x40, 0x40, 0x09,
-        0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x1b, 0x9f,
-        0x9f, 0x9f, 0xf3, 0xf3, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf2, 0xf2, 0x9e, 0x9e, 0x9e, 0x1a,
-        0x1a, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xa3, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0xa2, 0xa2, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0x5a, 0x5a, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0x18, 0x18, 0x98, 0x98, 0x98, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
-        0xee, 0xee, 0x97, 0x97, 0x97, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a,
-        0x5a, 0x5a, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0xeb,
-        0xeb, 0xeb, 0xec, 0xec, 0xec, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x06, 0x06, 0x06, 0x3b, 0x3b, 0x3b, 0x74, 0x74, 0x74, 0x9d, 0x9d, 0x9d, 0xbc, 0xbc, 0xbc, 0xdc,
-        0xdc, 0xdc, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xdb, 0xdb, 0xdb, 0xbc,
-        0xbc, 0xbc, 0x9d, 0x9d, 0x9d, 0x74, 0x74, 0x74, 0x3b, 0x3b, 0x3b, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xed, 0xed, 0xed, 0xeb, 0xeb, 0xeb, 0x19,
-        0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xb7, 0xb7, 0xb7, 0xff, 0xff, 0xff, 0x6a, 0x6a, 0x6a, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb0, 0xb0, 0x94, 0x94, 0x94, 0x3d, 0x3d, 0x3d, 0x08,
-        0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x1b,
-        0x1b, 0x1b, 0x2f, 0x2f, 0x2f, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x5c,
-        0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x55, 0x55, 0x55, 0x47, 0x47, 0x47, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x2f,
-        0x2f, 0x2f, 0x1a, 0x1a, 0x1a, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x08, 0x08, 0x08, 0x3d, 0x3d, 0x3d, 0x94, 0x94, 0x94, 0xb0, 0xb0, 0xb0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6b, 0x6b, 0xff, 0xff, 0xff, 0xb6, 0xb6, 0xb6, 0x01, 0x01, 0x01, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63,
-        0x63, 0x63, 0xff, 0xff, 0xff, 0xb6, 0xb6, 0xb6, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xd3, 0xd3, 0xd3, 0xa2,
-        0xa2, 0xa2, 0x78, 0x78, 0x78, 0x5e, 0x5e, 0x5e, 0x44, 0x44, 0x44, 0x2a, 0x2a, 0x2a, 0x10, 0x10, 0x10, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x2a, 0x2a, 0x2a, 0x44,
-        0x44, 0x44, 0x5e, 0x5e, 0x5e, 0x78, 0x78, 0x78, 0xa2, 0xa2, 0xa2, 0xd3, 0xd3, 0xd3, 0xf1, 0xf1, 0xf1, 0xcd,
-        0xcd, 0xcd, 0xa5, 0xa5, 0xa5, 0x63, 0x63, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x01, 0x01, 0xb7, 0xb7, 0xb7, 0xff, 0xff, 0xff, 0x61, 0x61, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0xdd, 0xdd, 0xdd, 0xf5, 0xf5, 0xf5, 0x19,
-        0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x4b, 0x4b, 0xee,
-        0xee, 0xee, 0x3d, 0x3d, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xee,
-        0xee, 0xee, 0xec, 0xec, 0xec, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xec, 0xec, 0xec, 0xee, 0xee, 0xee, 0xfd,
-        0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xc5, 0xc5, 0xc5, 0x9b, 0x9b, 0x9b, 0x73,
-        0x73, 0x73, 0x49, 0x49, 0x49, 0x21, 0x21, 0x21, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0xee, 0xee, 0xee, 0x4b,
-        0x4b, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x1b, 0x1b, 0xf7,
-        0xf7, 0xf7, 0xdc, 0xdc, 0xdc, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x5b, 0x5b, 0x5b, 0xff, 0xff, 0xff, 0x94, 0x94, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0xe9, 0xe9, 0xe9, 0xf7, 0xf7, 0xf7, 0x23, 0x23, 0x23, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-        0xe0, 0xe0, 0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
-        0x17, 0x17, 0x41, 0x41, 0x41, 0x69, 0x69, 0x69, 0x93, 0x93, 0x93, 0x8e, 0x8e, 0x8e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x23, 0x23, 0xf7, 0xf7, 0xf7, 0xe9, 0xe9, 0xe9, 0x16, 0x16, 0x16, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x96, 0x96, 0xff, 0xff, 0xff, 0x59,
-        0x59, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xcb, 0xcb, 0xfb,
-        0xfb, 0xfb, 0x21, 0x21, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
-        0xa0, 0xa0, 0xff, 0xff, 0xff, 0x6f, 0x6f, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x3b,
-        0x3b, 0x3b, 0x9a, 0x9a, 0x9a, 0xc4, 0xc4, 0xc4, 0xed, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x70, 0x70, 0x70, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0xfb, 0xfb, 0xfb, 0xc9, 0xc9, 0xc9, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0xfe, 0xfe, 0xfe, 0xba, 0xba, 0xba, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0xfa, 0xfa, 0xfa, 0xd2, 0xd2, 0xd2, 0x01,
-        0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xb3, 0xb3, 0xb3, 0x3e, 0x3e, 0x3e, 0x79, 0x79, 0x79, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xc5,
-        0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0xd4,
-        0xd4, 0xd4, 0xfa, 0xfa, 0xfa, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xbb, 0xbb, 0xbb, 0xfe, 0xfe, 0xfe, 0x16, 0x16, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
-        0x5d, 0x5d, 0xff, 0xff, 0xff, 0x74, 0x74, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x88, 0x88, 0x88, 0xff, 0xff, 0xff, 0x5c, 0x5c, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-        0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0x13, 0x13, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbf, 0xbf, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x5d, 0x5d, 0xff, 0xff, 0xff, 0x87,
-        0x87, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x75, 0x75, 0xff,
-        0xff, 0xff, 0x5b, 0x5b, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa1, 0xa1, 0xff, 0xff, 0xff, 0x2f,
-        0x2f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xd1, 0xf5,
-        0xf5, 0xf5, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a,
-        0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x2c, 0x2c, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0xd5,
-        0xd5, 0xd5, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0xf6, 0xf6, 0xf6, 0xd0, 0xd0, 0xd0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xfc, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0xfe, 0xfe, 0xfe, 0xb8, 0xb8, 0xb8, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xe1, 0xe1, 0xe1, 0x84, 0x84, 0x84, 0xbe, 0xbe, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5,
-        0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xb9, 0xb9, 0xb9, 0xfe, 0xfe, 0xfe, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0xca, 0xca, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea,
-        0xea, 0xea, 0xe8, 0xe8, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
-        0x37, 0x37, 0xff, 0xff, 0xff, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-        0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf1, 0xf1, 0xc9,
-        0xc9, 0xc9, 0x9f, 0x9f, 0x9f, 0x76, 0x76, 0x76, 0x4d, 0x4d, 0x4d, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x8b, 0x8b, 0xff,
-        0xff, 0xff, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8,
-        0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0xd1, 0xd1, 0xd1, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x4d, 0x4d, 0xff, 0xff, 0xff, 0x73,
-        0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x2f,
-        0x2f, 0x2f, 0x45, 0x45, 0x45, 0x1d, 0x1d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x74, 0xff, 0xff, 0xff, 0x4d, 0x4d, 0x4d, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xd2, 0xd2, 0xf6, 0xf6, 0xf6, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfa, 0xfa, 0xca, 0xca, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff, 0x6d, 0x6d, 0x6d, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xcd, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
-        0x1d, 0x1d, 0x45, 0x45, 0x45, 0x6f, 0x6f, 0x6f, 0x98, 0x98, 0x98, 0xc1, 0xc1, 0xc1, 0xeb, 0xeb, 0xeb, 0xc5,
-        0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x6d, 0x6d, 0x6d, 0xff, 0xff, 0xff, 0x54, 0x54, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xca, 0xca, 0xfa, 0xfa, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
-        0xf0, 0xf0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-        0x3f, 0x3f, 0xff, 0xff, 0xff, 0x82, 0x82, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xba, 0xba, 0xba, 0xc9, 0xc9, 0xc9, 0xf1, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-        0xf9, 0xf9, 0xd4, 0xd4, 0xd4, 0xab, 0xab, 0xab, 0x83, 0x83, 0x83, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x83, 0x83, 0xff,
-        0xff, 0xff, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1,
-        0xe1, 0xe1, 0xee, 0xee, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xd7, 0xd7, 0xf7, 0xf7, 0xf7, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x25, 0xff, 0xff, 0xff, 0xa3,
-        0xa3, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xd8, 0xd8, 0xa4,
-        0xa4, 0xa4, 0x7a, 0x7a, 0x7a, 0x52, 0x52, 0x52, 0x27, 0x27, 0x27, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xa5, 0xa5, 0xff, 0xff, 0xff, 0x24, 0x24, 0x24, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xf7, 0xf7, 0xd5, 0xd5, 0xd5, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xff, 0xff, 0xff, 0x1a, 0x1a, 0x1a, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xe8, 0xe8, 0xe8, 0xe5, 0xe5, 0xe5, 0x01, 0x01, 0x01, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xd8, 0xd8, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x10, 0x10, 0x39, 0x39, 0x39, 0x63, 0x63, 0x63, 0x8b, 0x8b, 0x8b, 0xb6, 0xb6, 0xb6, 0xa9,
-        0xa9, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x01, 0x01, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1a, 0x1a, 0x1a, 0xff, 0xff, 0xff, 0xb1, 0xb1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
-        0x74, 0x74, 0xff, 0xff, 0xff, 0x5d, 0x5d, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xa3, 0xa3, 0xa3, 0xff, 0xff, 0xff, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-        0xc3, 0xc3, 0x00, 0x00, 0x00, 0x4c, 0x4c, 0x4c, 0xbc, 0xbc, 0xbc, 0xe6, 0xe6, 0xe6, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0xff, 0xff, 0xff, 0xa2,
-        0xa2, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x5e, 0x5e, 0xff,
-        0xff, 0xff, 0x72, 0x72, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x2f, 0xff, 0xff, 0xff, 0xa2,
-        0xa2, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0xff,
-        0xff, 0xff, 0xab, 0xab, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a,
-        0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x24, 0x24, 0x24, 0x5f, 0x5f, 0x5f, 0xfc,
-        0xfc, 0xfc, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xac, 0xac, 0xff, 0xff, 0xff, 0x43, 0x43, 0x43, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xa3, 0xa3, 0xff, 0xff, 0xff, 0x2d, 0x2d, 0x2d, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xe7, 0xe7, 0xe7, 0xeb, 0xeb, 0xeb, 0x0a, 0x0a, 0x0a, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xca, 0xca, 0xfd, 0xfd, 0xfd, 0x36,
-        0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xb9, 0xb9, 0xff, 0xff, 0xff, 0xc5,
-        0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0xfd,
-        0xfd, 0xfd, 0xc9, 0xc9, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
-        0x0a, 0x0a, 0xec, 0xec, 0xec, 0xe5, 0xe5, 0xe5, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x83, 0x83, 0x83, 0xff, 0xff, 0xff, 0x6c, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0xfd, 0xfd, 0xfd, 0xd9, 0xd9, 0xd9, 0x0b, 0x0b, 0x0b, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-        0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0x38, 0x38, 0x00,
-        0x00, 0x00, 0x07, 0x07, 0x07, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0b, 0x0b, 0xda, 0xda, 0xda, 0xfd, 0xfd, 0xfd, 0x3e, 0x3e, 0x3e, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6e, 0x6e, 0xff, 0xff, 0xff, 0x81,
-        0x81, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0xf5,
-        0xf5, 0xf5, 0xdf, 0xdf, 0xdf, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x8a, 0x8a, 0x8a, 0xff, 0xff, 0xff, 0x4e, 0x4e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a,
-        0x7a, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0x9f, 0x9f, 0x9f, 0xd3, 0xd3, 0xd3, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f,
-        0x4f, 0x4f, 0xff, 0xff, 0xff, 0x8a, 0x8a, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x05, 0x05, 0x05, 0xe1, 0xe1, 0xe1, 0xf4, 0xf4, 0xf4, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x92, 0x92, 0xff, 0xff, 0xff, 0x7a,
-        0x7a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x47,
-        0x47, 0x47, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x7a, 0x7a, 0x7a, 0xff, 0xff, 0xff, 0xf7,
-        0xf7, 0xf7, 0xcf, 0xcf, 0xcf, 0xa7, 0xa7, 0xa7, 0x7c, 0x7c, 0x7c, 0x54, 0x54, 0x54, 0x2b, 0x2b, 0x2b, 0x06,
-        0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x47, 0x47, 0x47, 0x04,
-        0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0xff,
-        0xff, 0xff, 0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0xe3, 0xe3, 0xe3, 0xfa, 0xfa, 0xfa, 0x33, 0x33, 0x33, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-        0xc3, 0xc3, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x22, 0x22, 0x22, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0xfa, 0xfa, 0xfa, 0xe3, 0xe3, 0xe3, 0x10, 0x10, 0x10, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x44, 0x44, 0x44, 0xfe, 0xfe, 0xfe, 0xd0, 0xd0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xd5, 0xd5, 0x01, 0x01, 0x01, 0x00,
-        0x00, 0x00, 0x15, 0x15, 0x15, 0x40, 0x40, 0x40, 0x68, 0x68, 0x68, 0x91, 0x91, 0x91, 0xba, 0xba, 0xba, 0xe3,
-        0xe3, 0xe3, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1,
-        0xd1, 0xd1, 0xfe, 0xfe, 0xfe, 0x43, 0x43, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-        0x79, 0x79, 0xae, 0xae, 0xae, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xdb, 0xdb, 0xec, 0xec, 0xec, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5,
-        0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0xaf, 0xaf, 0xaf, 0x78, 0x78, 0x78, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xc5, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xc5, 0xc5, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x9a, 0x9a, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x5b,
-        0x5b, 0x5b, 0xb7, 0xb7, 0xb7, 0xf7, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xb6, 0xb6, 0xb6, 0x5a, 0x5a, 0x5a, 0x02,
-        0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-        0x05, 0x05, 0x37, 0x37, 0x37, 0x5f, 0x5f, 0x5f, 0x7f, 0x7f, 0x7f, 0x9e, 0x9e, 0x9e, 0xbe, 0xbe, 0xbe, 0xdd,
-        0xdd, 0xdd, 0xee, 0xee, 0xee, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xee,
-        0xee, 0xee, 0xdd, 0xdd, 0xdd, 0xbd, 0xbd, 0xbd, 0x9e, 0x9e, 0x9e, 0x7f, 0x7f, 0x7f, 0x5e, 0x5e, 0x5e, 0x37,
-        0x37, 0x37, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x12, 0x12, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x12,
-        0x12, 0x12, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x43, 0x43, 0x43, 0x33, 0x33, 0x33, 0x33,
-        0x33, 0x33, 0x23, 0x23, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x23, 0x23, 0x33, 0x33, 0x33, 0x33,
-        0x33, 0x33, 0x43, 0x43, 0x43, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x17, 0x17, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17,
-        0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 0x17, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x32,
-        0x32, 0x32, 0x7a, 0x7a, 0x7a, 0x1a, 0x1a, 0x1a, 0x17, 0x17, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0x17, 0x17, 0x1a, 0x1a, 0x1a, 0x7a, 0x7a, 0x7a, 0x32, 0x32, 0x32, 0x01,
-        0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-        0x12, 0x12, 0x55, 0x55, 0x55, 0x99, 0x99, 0x99, 0xe3, 0xe3, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28,
-        0x28, 0x28, 0x17, 0x17, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17,
-        0x17, 0x17, 0x28, 0x28, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xea, 0xea, 0xaa, 0xaa, 0xaa, 0x66,
-        0x66, 0x66, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-        0x02, 0x02, 0x33, 0x33, 0x33, 0x77, 0x77, 0x77, 0xbb, 0xbb, 0xbb, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x28, 0x28, 0x17, 0x17, 0x17, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0x17, 0x17, 0x28, 0x28, 0x28, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xcc,
-        0xcc, 0xcc, 0x88, 0x88, 0x88, 0x44, 0x44, 0x44, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x15, 0x15, 0x15, 0x5b, 0x5b, 0x5b, 0xa4, 0xa4, 0xa4, 0xea, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x2e, 0x2e, 0x0e, 0x0e, 0x0e, 0xeb, 0xeb, 0xeb, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xeb, 0xeb, 0xeb, 0x0e, 0x0e, 0x0e, 0x2e, 0x2e, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xea, 0xea, 0xea, 0xa4, 0xa4, 0xa4, 0x5b, 0x5b, 0x5b, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x47, 0x47, 0x47, 0x91,
-        0x91, 0x91, 0xda, 0xda, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73,
-        0x73, 0x73, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x38, 0x38, 0x38, 0x5a, 0x5a, 0x5a, 0x6e, 0x6e, 0x6e, 0x77,
-        0x77, 0x77, 0x77, 0x77, 0x77, 0x6e, 0x6e, 0x6e, 0x5a, 0x5a, 0x5a, 0x38, 0x38, 0x38, 0x05, 0x05, 0x05, 0x00,
-        0x00, 0x00, 0x75, 0x75, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,
-        0xda, 0xda, 0x91, 0x91, 0x91, 0x47, 0x47, 0x47, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
-        0x50, 0x50, 0x74, 0x74, 0x74, 0x2c, 0x2c, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
-        0x23, 0x23, 0x6b, 0x6b, 0x6b, 0xb4, 0xb4, 0xb4, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x8f, 0x8f, 0x8f, 0x39,
-        0x39, 0x39, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x39, 0x39, 0x39, 0x8f, 0x8f, 0x8f, 0xfb, 0xfb, 0xfb, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-        0xf5, 0xf5, 0xb4, 0xb4, 0xb4, 0x6b, 0x6b, 0x6b, 0x23, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x2c, 0x2c, 0x2c, 0x74, 0x74, 0x74, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x79, 0x79, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xe2, 0xe2, 0xe2, 0x9a, 0x9a, 0x9a, 0x52, 0x52, 0x52, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x08, 0x08, 0x08, 0x46, 0x46, 0x46, 0x8e, 0x8e, 0x8e, 0xd7, 0xd7, 0xd7, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-        0xf0, 0xf0, 0xdb, 0xdb, 0xdb, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xdb, 0xdb, 0xdb, 0xf0, 0xf0, 0xf0, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xd7, 0xd7, 0xd7, 0x8e, 0x8e, 0x8e, 0x46, 0x46, 0x46, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x52, 0x52, 0x52, 0x9a, 0x9a, 0x9a, 0xe2, 0xe2, 0xe2, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x79, 0x79, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x79, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xcc, 0xcc, 0xcc, 0x80, 0x80, 0x80, 0x33, 0x33, 0x33, 0x01,
-        0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x66, 0x66, 0x66, 0xaa, 0xaa, 0xaa, 0xf0,
-        0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xf5, 0xf5, 0xf5, 0xbb, 0xbb, 0xbb, 0x77, 0x77, 0x77, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x6f, 0x6f, 0x6f, 0xbb, 0xbb, 0xbb, 0xf9, 0xf9, 0xf9, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x79, 0x79, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-        0x79, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xe9, 0xaa, 0xaa, 0xaa, 0x5e,
-        0x5e, 0x5e, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x3c, 0x3c, 0x3c, 0x88,
-        0x88, 0x88, 0xcc, 0xcc, 0xcc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0x99, 0x99, 0x99, 0x4d, 0x4d, 0x4d, 0x07, 0x07, 0x07, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x0b, 0x0b, 0x4d, 0x4d, 0x4d, 0x99, 0x99, 0x99, 0xe2, 0xe2, 0xe2, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x79, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x79, 0x79, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xc3,
-        0xc3, 0xc3, 0x7a, 0x7a, 0x7a, 0x32, 0x32, 0x32, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
-        0x1d, 0x1d, 0x66, 0x66, 0x66, 0xae, 0xae, 0xae, 0xae, 0xae, 0xae, 0x66, 0x66, 0x66, 0x1d, 0x1d, 0x1d, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x32, 0x32, 0x32, 0x7a, 0x7a, 0x7a, 0xc3, 0xc3, 0xc3, 0xfb,
-        0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x79, 0x79, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x79, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xea, 0xea, 0xea, 0xaa, 0xaa, 0xaa, 0x66, 0x66, 0x66, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x12, 0x12, 0x55, 0x55, 0x55, 0x99, 0x99, 0x99, 0xe4,
-        0xe4, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x79, 0x79, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-        0x28, 0x28, 0x8a, 0x8a, 0x8a, 0xd2, 0xd2, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xc7, 0xc7, 0xc7, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0xc7,
-        0xc7, 0xc7, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xd2, 0xd2, 0xd2, 0x8a, 0x8a, 0x8a, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x17, 0x17, 0x17, 0x5e, 0x5e, 0x5e, 0xaa, 0xaa, 0xaa, 0xef, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xbb, 0xbb, 0xbb, 0x6f, 0x6f, 0x6f, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x33, 0x33, 0x33, 0x80, 0x80, 0x80, 0xcc, 0xcc, 0xcc, 0xfe,
-        0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-        0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xdd, 0xdd, 0x91, 0x91, 0x91, 0x44, 0x44, 0x44, 0x06, 0x06, 0x06, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x55, 0x55, 0x55, 0xa2,
-        0xa2, 0xa2, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3, 0xb3, 0xb3, 0xb3, 0x66, 0x66, 0x66, 0x1c, 0x1c, 0x1c, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x33,
-        0x33, 0x33, 0x77, 0x77, 0x77, 0xc4, 0xc4, 0xc4, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xd5, 0xd5, 0x88, 0x88, 0x88, 0x44, 0x44, 0x44, 0x05,
-        0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x14, 0x14, 0x14, 0x55, 0x55, 0x55, 0x99, 0x99, 0x99, 0xe6, 0xe6, 0xe6, 0xff, 0xff, 0xff, 0x1f,
-        0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0xff, 0xff, 0xff, 0xec, 0xec, 0xec, 0xaa, 0xaa, 0xaa, 0x66, 0x66, 0x66, 0x1b,
-        0x1b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x37, 0x37, 0x37, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x37,
-        0x37, 0x37, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+#include "image.h"
 
-const uint8_t cross[] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff,
-        0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xa0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff};
+static const uint8_t logo_palette[] = {0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x0c, 0x0c, 0x0c, 0x10,
+        0x10, 0x10, 0x14, 0x14, 0x14, 0x18, 0x18, 0x18, 0x1c, 0x1c, 0x1c, 0x20, 0x20, 0x20, 0x24, 0x24, 0x24, 0x28,
+        0x28, 0x28, 0x2c, 0x2c, 0x2c, 0x30, 0x30, 0x30, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x40,
+        0x40, 0x40, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x4c, 0x4c, 0x4c, 0x50, 0x50, 0x50, 0x54, 0x54, 0x54, 0x58,
+        0x58, 0x58, 0x5c, 0x5c, 0x5c, 0x60, 0x60, 0x60, 0x64, 0x64, 0x64, 0x68, 0x68, 0x68, 0x6c, 0x6c, 0x6c, 0x70,
+        0x70, 0x70, 0x74, 0x74, 0x74, 0x78, 0x78, 0x78, 0x7c, 0x7c, 0x7c, 0x80, 0x80, 0x80, 0x84, 0x84, 0x84, 0x88,
+        0x88, 0x88, 0x8c, 0x8c, 0x8c, 0x90, 0x90, 0x90, 0x94, 0x94, 0x94, 0x98, 0x98, 0x98, 0x9c, 0x9c, 0x9c, 0xa0,
+        0xa0, 0xa0, 0xa4, 0xa4, 0xa4, 0xa8, 0xa8, 0xa8, 0xac, 0xac, 0xac, 0xb0, 0xb0, 0xb0, 0xb4, 0xb4, 0xb4, 0xb8,
+        0xb8, 0xb8, 0xbc, 0xbc, 0xbc, 0xc0, 0xc0, 0xc0, 0xc4, 0xc4, 0xc4, 0xc8, 0xc8, 0xc8, 0xcc, 0xcc, 0xcc, 0xd0,
+        0xd0, 0xd0, 0xd4, 0xd4, 0xd4, 0xd8, 0xd8, 0xd8, 0xdc, 0xdc, 0xdc, 0xe0, 0xe0, 0xe0, 0xe4, 0xe4, 0xe4, 0xe8,
+        0xe8, 0xe8, 0xec, 0xec, 0xec, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf8, 0xf8, 0xf8, 0xfc, 0xfc, 0xfc};
 
-const uint8_t volume[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x48, 0x48, 0x48,
-        0x25, 0x25, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x55, 0x55, 0x55, 0xc7, 0xc7, 0xc7, 0x43, 0x43, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x97, 0x97, 0x97, 0xff, 0xff, 0xff,
-        0xe4, 0xe4, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xb3, 0xb3, 0xb3, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x34, 0x34, 0x34, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xd5, 0xd5, 0xd5, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x4a, 0x4a, 0x4a, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x5e, 0x5e, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0x68, 0x68, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0x61, 0x61, 0x61,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4, 0xc4, 0xff, 0xff, 0xff, 0xe3, 0xe3, 0xe3, 0x02, 0x02, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x34, 0x95, 0x95, 0x95, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-        0xb7, 0xb7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0xd4, 0xd4, 0xd4, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4,
-        0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0x38, 0x38,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xc2, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x27, 0x27, 0xf9, 0xf9, 0xf9, 0xff, 0xff, 0xff,
-        0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0x83, 0x83, 0x83,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xab, 0xab, 0xff, 0xff, 0xff,
-        0xcf, 0xcf, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xa5,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x74, 0x74, 0xff, 0xff, 0xff,
-        0xf2, 0xf2, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xa6, 0xa6, 0xff, 0xff, 0xff, 0xbf, 0xbf, 0xbf,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x73, 0x73, 0xff, 0xff, 0xff,
-        0xf2, 0xf2, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xa7, 0xa7, 0xff, 0xff, 0xff, 0xbf, 0xbf, 0xbf,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff,
-        0xd0, 0xd0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xc1, 0xc1, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xa5,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xc2, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x29, 0x29, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xff,
-        0x84, 0x84, 0x84, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0x82, 0x82, 0x82,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x95, 0x95, 0x95, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-        0xb7, 0xb7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0xd4, 0xd4, 0xd4, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xf3,
-        0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x4a, 0x4a, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0x38, 0x38,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0x5f, 0x5f, 0x5f,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4, 0xc4, 0xff, 0xff, 0xff, 0xe3, 0xe3, 0xe3, 0x02, 0x02, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x93, 0x93, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x5f, 0x5f, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x93, 0x93, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x34, 0x34, 0x34, 0xf6, 0xf6, 0xf6, 0xff, 0xff, 0xff, 0xd4, 0xd4, 0xd4, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x97, 0x97, 0x97, 0xff, 0xff, 0xff,
-        0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xb3, 0xb3, 0xb3, 0xff, 0xff, 0xff, 0xef, 0xef, 0xef, 0x27, 0x27, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x47, 0x47, 0x47,
-        0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x54, 0x54, 0x54, 0xc6, 0xc6, 0xc6, 0x43, 0x43, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00};
+static const uint8_t logo_data[] = {0xff, 0x00, 0xff, 0x00, 0x97, 0x00, 0x06, 0x01, 0x08, 0x0c, 0x0e, 0x11, 0x13, 0x15,
+        0x81, 0x18, 0x06, 0x15, 0x13, 0x11, 0x0e, 0x0c, 0x08, 0x01, 0xa9, 0x00, 0x05, 0x02, 0x10, 0x1e, 0x28, 0x30,
+        0x38, 0x8e, 0x3f, 0x06, 0x3e, 0x38, 0x30, 0x28, 0x1e, 0x10, 0x02, 0xa1, 0x00, 0x02, 0x06, 0x27, 0x3c, 0x99,
+        0x3f, 0x02, 0x3c, 0x27, 0x06, 0x9f, 0x00, 0x00, 0x28, 0x9d, 0x3f, 0x00, 0x28, 0x94, 0x00, 0x01, 0x0d, 0x16,
+        0x88, 0x00, 0x02, 0x06, 0x26, 0x3b, 0x99, 0x3f, 0x02, 0x3b, 0x25, 0x06, 0x88, 0x00, 0x01, 0x16, 0x0c, 0x88,
+        0x00, 0x02, 0x06, 0x3a, 0x3b, 0x8a, 0x00, 0x06, 0x01, 0x0e, 0x1d, 0x27, 0x2f, 0x37, 0x3e, 0x8d, 0x3f, 0x06,
+        0x3e, 0x36, 0x2f, 0x27, 0x1d, 0x0e, 0x01, 0x8a, 0x00, 0x02, 0x3b, 0x3a, 0x06, 0x87, 0x00, 0x02, 0x2d, 0x3f,
+        0x1a, 0x88, 0x00, 0x03, 0x2c, 0x25, 0x0f, 0x02, 0x84, 0x00, 0x05, 0x06, 0x0b, 0x0c, 0x11, 0x12, 0x15, 0x81,
+        0x17, 0x00, 0x15, 0x81, 0x11, 0x02, 0x0c, 0x0b, 0x06, 0x84, 0x00, 0x03, 0x02, 0x0f, 0x25, 0x2c, 0x88, 0x00,
+        0x02, 0x1a, 0x3f, 0x2d, 0x86, 0x00, 0x02, 0x18, 0x3f, 0x2d, 0x89, 0x00, 0x00, 0x31, 0x81, 0x3f, 0x07, 0x3e,
+        0x34, 0x28, 0x1e, 0x17, 0x11, 0x0a, 0x04, 0x89, 0x00, 0x0a, 0x04, 0x0a, 0x11, 0x17, 0x1e, 0x28, 0x34, 0x3c,
+        0x33, 0x29, 0x18, 0x89, 0x00, 0x02, 0x2d, 0x3f, 0x18, 0x84, 0x00, 0x03, 0x01, 0x37, 0x3d, 0x06, 0x83, 0x00,
+        0x02, 0x12, 0x3b, 0x0f, 0x82, 0x00, 0x00, 0x31, 0x8b, 0x3f, 0x81, 0x3b, 0x81, 0x37, 0x81, 0x3b, 0x82, 0x3f,
+        0x05, 0x3c, 0x31, 0x26, 0x1c, 0x12, 0x08, 0x86, 0x00, 0x02, 0x0f, 0x3b, 0x12, 0x83, 0x00, 0x02, 0x06, 0x3d,
+        0x37, 0x84, 0x00, 0x02, 0x16, 0x3f, 0x25, 0x83, 0x00, 0x03, 0x05, 0x3a, 0x3d, 0x08, 0x82, 0x00, 0x00, 0x31,
+        0x93, 0x3f, 0x01, 0x38, 0x02, 0x83, 0x00, 0x04, 0x05, 0x10, 0x1a, 0x24, 0x23, 0x82, 0x00, 0x03, 0x08, 0x3d,
+        0x3a, 0x05, 0x83, 0x00, 0x02, 0x25, 0x3f, 0x16, 0x83, 0x00, 0x02, 0x32, 0x3e, 0x08, 0x83, 0x00, 0x02, 0x28,
+        0x3f, 0x1b, 0x83, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x05, 0x30, 0x00, 0x0e, 0x26, 0x31, 0x3b, 0x83, 0x3f, 0x00,
+        0x31, 0x83, 0x00, 0x02, 0x1c, 0x3f, 0x27, 0x83, 0x00, 0x02, 0x08, 0x3e, 0x32, 0x82, 0x00, 0x02, 0x06, 0x3f,
+        0x2e, 0x83, 0x00, 0x02, 0x07, 0x3e, 0x34, 0x84, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x02, 0x30, 0x00, 0x1e, 0x81,
+        0x3f, 0x02, 0x2c, 0x0f, 0x1e, 0x81, 0x3f, 0x00, 0x31, 0x84, 0x00, 0x02, 0x35, 0x3e, 0x07, 0x83, 0x00, 0x02,
+        0x2e, 0x3f, 0x05, 0x81, 0x00, 0x02, 0x17, 0x3f, 0x1d, 0x83, 0x00, 0x02, 0x22, 0x3f, 0x17, 0x84, 0x00, 0x00,
+        0x31, 0x93, 0x3f, 0x02, 0x30, 0x00, 0x1e, 0x81, 0x3f, 0x00, 0x04, 0x81, 0x00, 0x02, 0x2f, 0x3f, 0x31, 0x84,
+        0x00, 0x02, 0x17, 0x3f, 0x21, 0x83, 0x00, 0x02, 0x1d, 0x3f, 0x16, 0x81, 0x00, 0x02, 0x28, 0x3f, 0x0b, 0x83,
+        0x00, 0x02, 0x34, 0x3d, 0x02, 0x84, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x02, 0x30, 0x00, 0x1e, 0x81, 0x3f, 0x00,
+        0x0b, 0x81, 0x00, 0x02, 0x35, 0x3f, 0x31, 0x84, 0x00, 0x02, 0x02, 0x3d, 0x34, 0x83, 0x00, 0x02, 0x0c, 0x3f,
+        0x27, 0x81, 0x00, 0x01, 0x33, 0x3f, 0x83, 0x00, 0x02, 0x05, 0x3f, 0x2e, 0x85, 0x00, 0x00, 0x31, 0x93, 0x3f,
+        0x02, 0x30, 0x00, 0x1e, 0x81, 0x3f, 0x02, 0x38, 0x21, 0x2f, 0x81, 0x3f, 0x00, 0x31, 0x85, 0x00, 0x02, 0x2e,
+        0x3f, 0x05, 0x83, 0x00, 0x01, 0x3f, 0x32, 0x81, 0x00, 0x81, 0x3a, 0x83, 0x00, 0x02, 0x0d, 0x3f, 0x22, 0x85,
+        0x00, 0x00, 0x31, 0x93, 0x3f, 0x02, 0x30, 0x00, 0x1e, 0x81, 0x3f, 0x05, 0x3c, 0x32, 0x27, 0x1d, 0x13, 0x07,
+        0x85, 0x00, 0x02, 0x22, 0x3f, 0x0d, 0x83, 0x00, 0x81, 0x3a, 0x81, 0x00, 0x01, 0x3d, 0x34, 0x83, 0x00, 0x02,
+        0x13, 0x3f, 0x1c, 0x85, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x04, 0x30, 0x00, 0x0b, 0x11, 0x07, 0x84, 0x00, 0x00,
+        0x03, 0x85, 0x00, 0x02, 0x1d, 0x3f, 0x13, 0x83, 0x00, 0x01, 0x34, 0x3d, 0x81, 0x00, 0x01, 0x3e, 0x32, 0x83,
+        0x00, 0x02, 0x15, 0x3f, 0x1b, 0x85, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x00, 0x33, 0x82, 0x00, 0x06, 0x07, 0x11,
+        0x1b, 0x26, 0x30, 0x3a, 0x31, 0x85, 0x00, 0x02, 0x1b, 0x3f, 0x15, 0x83, 0x00, 0x01, 0x32, 0x3e, 0x81, 0x00,
+        0x01, 0x3c, 0x38, 0x83, 0x00, 0x02, 0x0f, 0x3f, 0x20, 0x85, 0x00, 0x00, 0x31, 0x94, 0x3f, 0x02, 0x2e, 0x32,
+        0x3c, 0x81, 0x3f, 0x04, 0x3e, 0x35, 0x2a, 0x20, 0x12, 0x85, 0x00, 0x02, 0x20, 0x3f, 0x0f, 0x83, 0x00, 0x01,
+        0x38, 0x3b, 0x81, 0x00, 0x01, 0x35, 0x3d, 0x83, 0x00, 0x02, 0x09, 0x3f, 0x28, 0x85, 0x00, 0x00, 0x31, 0x94,
+        0x3f, 0x05, 0x36, 0x29, 0x1e, 0x14, 0x09, 0x01, 0x89, 0x00, 0x02, 0x29, 0x3f, 0x09, 0x83, 0x00, 0x01, 0x3d,
+        0x35, 0x81, 0x00, 0x02, 0x2c, 0x3f, 0x06, 0x83, 0x00, 0x01, 0x3a, 0x39, 0x85, 0x00, 0x00, 0x31, 0x93, 0x3f,
+        0x00, 0x36, 0x83, 0x00, 0x05, 0x04, 0x0e, 0x18, 0x22, 0x2d, 0x2a, 0x85, 0x00, 0x81, 0x39, 0x83, 0x00, 0x02,
+        0x06, 0x3f, 0x2c, 0x81, 0x00, 0x02, 0x1d, 0x3f, 0x17, 0x83, 0x00, 0x02, 0x28, 0x3f, 0x0d, 0x84, 0x00, 0x00,
+        0x31, 0x93, 0x3f, 0x04, 0x30, 0x00, 0x13, 0x2f, 0x39, 0x84, 0x3f, 0x00, 0x31, 0x84, 0x00, 0x02, 0x0e, 0x3f,
+        0x28, 0x83, 0x00, 0x02, 0x17, 0x3f, 0x1c, 0x81, 0x00, 0x02, 0x0b, 0x3f, 0x28, 0x83, 0x00, 0x02, 0x11, 0x3f,
+        0x2a, 0x84, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x02, 0x30, 0x00, 0x1e, 0x81, 0x3f, 0x02, 0x27, 0x09, 0x17, 0x81,
+        0x3f, 0x00, 0x31, 0x84, 0x00, 0x02, 0x2b, 0x3f, 0x10, 0x83, 0x00, 0x02, 0x28, 0x3f, 0x0b, 0x82, 0x00, 0x02,
+        0x39, 0x3a, 0x02, 0x83, 0x00, 0x02, 0x32, 0x3f, 0x0d, 0x83, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x02, 0x30, 0x00,
+        0x1e, 0x81, 0x3f, 0x00, 0x03, 0x81, 0x00, 0x02, 0x2e, 0x3f, 0x31, 0x83, 0x00, 0x02, 0x0e, 0x3f, 0x32, 0x83,
+        0x00, 0x02, 0x02, 0x3b, 0x39, 0x83, 0x00, 0x02, 0x20, 0x3f, 0x1b, 0x83, 0x00, 0x03, 0x0f, 0x3f, 0x36, 0x02,
+        0x82, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x02, 0x30, 0x00, 0x1e, 0x81, 0x3f, 0x05, 0x0e, 0x00, 0x01, 0x37, 0x3f,
+        0x31, 0x82, 0x00, 0x03, 0x02, 0x36, 0x3f, 0x0f, 0x83, 0x00, 0x02, 0x1b, 0x3f, 0x20, 0x83, 0x00, 0x03, 0x05,
+        0x3d, 0x37, 0x01, 0x83, 0x00, 0x02, 0x22, 0x3f, 0x13, 0x82, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x02, 0x30, 0x00,
+        0x1e, 0x81, 0x3f, 0x02, 0x3b, 0x27, 0x34, 0x81, 0x3f, 0x00, 0x31, 0x82, 0x00, 0x02, 0x13, 0x3f, 0x22, 0x83,
+        0x00, 0x03, 0x01, 0x38, 0x3d, 0x05, 0x84, 0x00, 0x02, 0x24, 0x3f, 0x1e, 0x83, 0x00, 0x02, 0x01, 0x11, 0x01,
+        0x82, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x0a, 0x30, 0x00, 0x1e, 0x3f, 0x3d, 0x33, 0x29, 0x1f, 0x15, 0x0a, 0x01,
+        0x82, 0x00, 0x02, 0x01, 0x11, 0x01, 0x83, 0x00, 0x02, 0x1f, 0x3f, 0x24, 0x85, 0x00, 0x03, 0x04, 0x38, 0x3e,
+        0x0c, 0x88, 0x00, 0x00, 0x31, 0x93, 0x3f, 0x03, 0x30, 0x00, 0x07, 0x08, 0x84, 0x00, 0x01, 0x03, 0x09, 0x88,
+        0x00, 0x03, 0x0c, 0x3e, 0x38, 0x04, 0x86, 0x00, 0x02, 0x11, 0x3f, 0x34, 0x88, 0x00, 0x00, 0x31, 0x93, 0x3f,
+        0x00, 0x35, 0x81, 0x00, 0x07, 0x05, 0x10, 0x1a, 0x24, 0x2e, 0x38, 0x3f, 0x31, 0x88, 0x00, 0x02, 0x34, 0x3f,
+        0x10, 0x88, 0x00, 0x01, 0x1e, 0x2b, 0x88, 0x00, 0x00, 0x31, 0x94, 0x3f, 0x01, 0x36, 0x3b, 0x86, 0x3f, 0x00,
+        0x31, 0x88, 0x00, 0x01, 0x2b, 0x1e, 0x94, 0x00, 0x00, 0x31, 0x9d, 0x3f, 0x00, 0x31, 0x9f, 0x00, 0x00, 0x26,
+        0x9d, 0x3f, 0x00, 0x26, 0xa0, 0x00, 0x02, 0x16, 0x2d, 0x3d, 0x97, 0x3f, 0x02, 0x3d, 0x2d, 0x16, 0xa3, 0x00,
+        0x08, 0x01, 0x0d, 0x17, 0x1f, 0x27, 0x2f, 0x37, 0x3b, 0x3e, 0x87, 0x3f, 0x08, 0x3e, 0x3b, 0x37, 0x2f, 0x27,
+        0x1f, 0x17, 0x0d, 0x01, 0xaf, 0x00, 0x01, 0x03, 0x04, 0x81, 0x08, 0x01, 0x04, 0x03, 0xb6, 0x00, 0x01, 0x01,
+        0x10, 0x81, 0x0c, 0x83, 0x08, 0x81, 0x0c, 0x01, 0x10, 0x01, 0xb3, 0x00, 0x00, 0x05, 0x89, 0x3f, 0x00, 0x05,
+        0xb3, 0x00, 0x00, 0x05, 0x89, 0x3f, 0x00, 0x05, 0xb0, 0x00, 0x03, 0x0c, 0x1e, 0x06, 0x05, 0x89, 0x3f, 0x03,
+        0x05, 0x06, 0x1e, 0x0c, 0xa9, 0x00, 0x03, 0x04, 0x15, 0x26, 0x38, 0x81, 0x3f, 0x01, 0x0a, 0x05, 0x89, 0x3f,
+        0x01, 0x05, 0x0a, 0x81, 0x3f, 0x03, 0x3a, 0x2a, 0x19, 0x06, 0xa2, 0x00, 0x03, 0x0c, 0x1d, 0x2e, 0x3e, 0x84,
+        0x3f, 0x01, 0x0a, 0x05, 0x89, 0x3f, 0x01, 0x05, 0x0a, 0x85, 0x3f, 0x03, 0x33, 0x22, 0x11, 0x01, 0x9a, 0x00,
+        0x03, 0x05, 0x16, 0x29, 0x3a, 0x88, 0x3f, 0x02, 0x0b, 0x03, 0x3a, 0x87, 0x3f, 0x02, 0x3a, 0x03, 0x0b, 0x88,
+        0x3f, 0x03, 0x3a, 0x29, 0x16, 0x05, 0x97, 0x00, 0x02, 0x11, 0x24, 0x36, 0x89, 0x3f, 0x05, 0x1c, 0x00, 0x01,
+        0x0e, 0x16, 0x1b, 0x81, 0x1d, 0x05, 0x1b, 0x16, 0x0e, 0x01, 0x00, 0x1d, 0x89, 0x3f, 0x02, 0x36, 0x24, 0x11,
+        0x94, 0x00, 0x02, 0x14, 0x1d, 0x0b, 0x82, 0x00, 0x03, 0x08, 0x1a, 0x2d, 0x3d, 0x85, 0x3f, 0x03, 0x3e, 0x23,
+        0x0e, 0x02, 0x85, 0x00, 0x03, 0x02, 0x0e, 0x23, 0x3e, 0x85, 0x3f, 0x03, 0x3d, 0x2d, 0x1a, 0x08, 0x82, 0x00,
+        0x02, 0x0b, 0x1d, 0x14, 0x91, 0x00, 0x00, 0x1e, 0x81, 0x3f, 0x03, 0x38, 0x26, 0x14, 0x03, 0x81, 0x00, 0x03,
+        0x02, 0x11, 0x23, 0x35, 0x86, 0x3f, 0x01, 0x3c, 0x36, 0x81, 0x32, 0x01, 0x36, 0x3c, 0x86, 0x3f, 0x03, 0x35,
+        0x23, 0x11, 0x02, 0x81, 0x00, 0x03, 0x03, 0x14, 0x26, 0x38, 0x81, 0x3f, 0x00, 0x1e, 0x91, 0x00, 0x00, 0x1e,
+        0x85, 0x3f, 0x02, 0x33, 0x20, 0x0c, 0x82, 0x00, 0x03, 0x08, 0x19, 0x2a, 0x3c, 0x8b, 0x3f, 0x03, 0x3d, 0x2e,
+        0x1d, 0x0a, 0x82, 0x00, 0x03, 0x08, 0x1b, 0x2e, 0x3e, 0x84, 0x3f, 0x00, 0x1e, 0x91, 0x00, 0x00, 0x1e, 0x88,
+        0x3f, 0x03, 0x3a, 0x2a, 0x17, 0x04, 0x81, 0x00, 0x03, 0x01, 0x0f, 0x22, 0x33, 0x85, 0x3f, 0x03, 0x37, 0x26,
+        0x13, 0x01, 0x81, 0x00, 0x03, 0x02, 0x13, 0x26, 0x38, 0x88, 0x3f, 0x00, 0x1e, 0x91, 0x00, 0x00, 0x1e, 0x8b,
+        0x3f, 0x03, 0x3e, 0x30, 0x1e, 0x0c, 0x82, 0x00, 0x01, 0x07, 0x19, 0x81, 0x2b, 0x01, 0x19, 0x07, 0x82, 0x00,
+        0x03, 0x0c, 0x1e, 0x30, 0x3e, 0x8b, 0x3f, 0x00, 0x1e, 0x91, 0x00, 0x00, 0x1e, 0x8f, 0x3f, 0x03, 0x3a, 0x2a,
+        0x19, 0x06, 0x83, 0x00, 0x03, 0x04, 0x15, 0x26, 0x39, 0x8f, 0x3f, 0x00, 0x1e, 0x91, 0x00, 0x02, 0x0a, 0x22,
+        0x34, 0x91, 0x3f, 0x00, 0x31, 0x81, 0x04, 0x00, 0x31, 0x91, 0x3f, 0x02, 0x34, 0x22, 0x0a, 0x94, 0x00, 0x03,
+        0x05, 0x17, 0x2a, 0x3b, 0x8e, 0x3f, 0x81, 0x07, 0x8e, 0x3f, 0x03, 0x3d, 0x2e, 0x1b, 0x07, 0x9b, 0x00, 0x02,
+        0x0c, 0x20, 0x33, 0x8b, 0x3f, 0x81, 0x07, 0x8b, 0x3f, 0x03, 0x37, 0x24, 0x11, 0x01, 0xa1, 0x00, 0x03, 0x05,
+        0x15, 0x28, 0x3b, 0x87, 0x3f, 0x81, 0x07, 0x87, 0x3f, 0x03, 0x3c, 0x2c, 0x19, 0x07, 0xa9, 0x00, 0x02, 0x0c,
+        0x1d, 0x31, 0x84, 0x3f, 0x81, 0x07, 0x84, 0x3f, 0x03, 0x35, 0x22, 0x11, 0x01, 0xaf, 0x00, 0x04, 0x05, 0x15,
+        0x26, 0x39, 0x3f, 0x81, 0x07, 0x04, 0x3f, 0x3b, 0x2a, 0x19, 0x06, 0xb7, 0x00, 0x00, 0x0d, 0x81, 0x03, 0x00,
+        0x0d, 0xff, 0x00, 0xff, 0x00, 0x9d, 0x00};
+
+const image_t logo = {.width = 64, .height = 64, .colors = 64, .palette = logo_palette, .data = logo_data,
+        .size = sizeof(logo_data)};
+
+static const uint8_t cross_palette[] = {0xfc, 0xa0, 0x00, 0xfc, 0xfc, 0xfc};
+
+static const uint8_t cross_data[] = {0x82, 0x01, 0x91, 0x00, 0x86, 0x01, 0x8f, 0x00, 0x88, 0x01, 0x8d, 0x00, 0x84, 0x01,
+        0x00, 0x00, 0x84, 0x01, 0x8b, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x89, 0x00, 0x84, 0x01, 0x84, 0x00,
+        0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x86, 0x00, 0x84, 0x01, 0x85, 0x00, 0x84, 0x01, 0x88, 0x00, 0x84, 0x01,
+        0x83, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x81, 0x00, 0x84, 0x01, 0x8c, 0x00, 0x89, 0x01, 0x8e, 0x00,
+        0x87, 0x01, 0x90, 0x00, 0x85, 0x01, 0x91, 0x00, 0x85, 0x01, 0x90, 0x00, 0x87, 0x01, 0x8e, 0x00, 0x89, 0x01,
+        0x8c, 0x00, 0x84, 0x01, 0x81, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x83, 0x00, 0x84, 0x01, 0x88, 0x00,
+        0x84, 0x01, 0x85, 0x00, 0x84, 0x01, 0x86, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x84, 0x00, 0x84, 0x01,
+        0x89, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8b, 0x00, 0x84, 0x01, 0x00, 0x00, 0x84, 0x01, 0x8d, 0x00,
+        0x88, 0x01, 0x8f, 0x00, 0x86, 0x01, 0x91, 0x00, 0x82, 0x01};
+
+const image_t cross = {.width = 24, .height = 24, .colors = 2, .palette = cross_palette, .data = cross_data,
+        .size = sizeof(cross_data)};
+
+static const uint8_t volume_palette[] = {0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x14, 0x14, 0x14, 0x18, 0x18, 0x18, 0x24,
+        0x24, 0x24, 0x28, 0x28, 0x28, 0x30, 0x30, 0x30, 0x34, 0x34, 0x34, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x3c, 0x40,
+        0x40, 0x40, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x54, 0x54, 0x54, 0x5c, 0x5c, 0x5c, 0x60, 0x60, 0x60, 0x64,
+        0x64, 0x64, 0x68, 0x68, 0x68, 0x70, 0x70, 0x70, 0x74, 0x74, 0x74, 0x80, 0x80, 0x80, 0x84, 0x84, 0x84, 0x90,
+        0x90, 0x90, 0x94, 0x94, 0x94, 0x98, 0x98, 0x98, 0xa4, 0xa4, 0xa4, 0xa8, 0xa8, 0xa8, 0xb0, 0xb0, 0xb0, 0xb4,
+        0xb4, 0xb4, 0xbc, 0xbc, 0xbc, 0xc0, 0xc0, 0xc0, 0xc4, 0xc4, 0xc4, 0xcc, 0xcc, 0xcc, 0xd0, 0xd0, 0xd0, 0xd4,
+        0xd4, 0xd4, 0xe0, 0xe0, 0xe0, 0xe4, 0xe4, 0xe4, 0xec, 0xec, 0xec, 0xf0, 0xf0, 0xf0, 0xf4, 0xf4, 0xf4, 0xf8,
+        0xf8, 0xf8, 0xfc, 0xfc, 0xfc};
+
+static const uint8_t volume_data[] = {0xd1, 0x00, 0x01, 0x0c, 0x04, 0x84, 0x00, 0x02, 0x0d, 0x1f, 0x0a, 0x8c, 0x00,
+        0x02, 0x17, 0x29, 0x24, 0x84, 0x00, 0x03, 0x1b, 0x29, 0x26, 0x05, 0x8a, 0x00, 0x00, 0x17, 0x82, 0x29, 0x84,
+        0x00, 0x04, 0x07, 0x27, 0x29, 0x22, 0x01, 0x88, 0x00, 0x00, 0x17, 0x83, 0x29, 0x81, 0x00, 0x01, 0x0a, 0x0c,
+        0x81, 0x00, 0x00, 0x0e, 0x81, 0x29, 0x00, 0x11, 0x87, 0x00, 0x00, 0x17, 0x84, 0x29, 0x01, 0x00, 0x02, 0x81,
+        0x29, 0x00, 0x0f, 0x81, 0x00, 0x02, 0x1f, 0x29, 0x23, 0x82, 0x00, 0x01, 0x07, 0x17, 0x81, 0x18, 0x00, 0x1c,
+        0x85, 0x29, 0x07, 0x00, 0x01, 0x22, 0x29, 0x27, 0x03, 0x00, 0x0c, 0x81, 0x29, 0x00, 0x08, 0x81, 0x00, 0x00,
+        0x1e, 0x89, 0x29, 0x81, 0x00, 0x08, 0x04, 0x28, 0x29, 0x15, 0x00, 0x01, 0x26, 0x29, 0x14, 0x81, 0x00, 0x00,
+        0x20, 0x89, 0x29, 0x82, 0x00, 0x02, 0x1a, 0x29, 0x20, 0x81, 0x00, 0x02, 0x1e, 0x29, 0x19, 0x81, 0x00, 0x00,
+        0x20, 0x89, 0x29, 0x82, 0x00, 0x02, 0x13, 0x29, 0x26, 0x81, 0x00, 0x02, 0x19, 0x29, 0x1d, 0x81, 0x00, 0x00,
+        0x20, 0x89, 0x29, 0x82, 0x00, 0x02, 0x12, 0x29, 0x26, 0x81, 0x00, 0x02, 0x19, 0x29, 0x1d, 0x81, 0x00, 0x00,
+        0x20, 0x89, 0x29, 0x82, 0x00, 0x02, 0x1a, 0x29, 0x21, 0x81, 0x00, 0x02, 0x1e, 0x29, 0x19, 0x81, 0x00, 0x00,
+        0x1e, 0x89, 0x29, 0x81, 0x00, 0x08, 0x05, 0x28, 0x29, 0x15, 0x00, 0x01, 0x26, 0x29, 0x14, 0x81, 0x00, 0x01,
+        0x06, 0x17, 0x81, 0x18, 0x00, 0x1c, 0x85, 0x29, 0x07, 0x00, 0x01, 0x22, 0x29, 0x26, 0x03, 0x00, 0x0c, 0x81,
+        0x29, 0x00, 0x08, 0x86, 0x00, 0x00, 0x17, 0x84, 0x29, 0x04, 0x00, 0x02, 0x28, 0x29, 0x0e, 0x81, 0x00, 0x02,
+        0x1f, 0x29, 0x23, 0x88, 0x00, 0x00, 0x16, 0x83, 0x29, 0x81, 0x00, 0x01, 0x09, 0x0c, 0x81, 0x00, 0x00, 0x0e,
+        0x81, 0x29, 0x00, 0x10, 0x89, 0x00, 0x00, 0x16, 0x82, 0x29, 0x84, 0x00, 0x04, 0x07, 0x27, 0x29, 0x22, 0x01,
+        0x8a, 0x00, 0x02, 0x17, 0x29, 0x23, 0x84, 0x00, 0x03, 0x1b, 0x29, 0x25, 0x04, 0x8c, 0x00, 0x01, 0x0b, 0x04,
+        0x84, 0x00, 0x02, 0x0d, 0x1f, 0x0a, 0xcb, 0x00};
+
+const image_t volume = {.width = 24, .height = 24, .colors = 42, .palette = volume_palette, .data = volume_data,
+        .size = sizeof(volume_data)};
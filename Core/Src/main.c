@@ -30,6 +30,13 @@
 #include "buzzer.h"
 #include "menu.h"
 #include "map.h"
+#include "profile.h"
+#include "motor.h"
+#include "store.h"
+#include "export.h"
+#include "bridge.h"
+#include "record.h"
+#include "cdc.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -119,7 +126,11 @@ int main(void)
     MX_TIM1_Init();
     MX_USART2_UART_Init();
     /* USER CODE BEGIN 2 */
+    PROFILE_Init();
+    STORE_Init();
     RPLIDAR_Init(&huart2);
+    RPLIDAR_DiscoverScanModes();
+    CDC_Init();
     ILI9488_Init(ili9488_config, ILI9488_Orientation_90);
     XPT2046_Init(xpt2046_config);
     Buzzer_Init(&htim2, TIM_CHANNEL_2, &htim1);
@@ -134,6 +145,11 @@ int main(void)
     {
         MENU_UpdateScreen();
         MENU_HandleTouch();
+        MOTOR_Update();
+        EXPORT_Update();
+        BRIDGE_Update();
+        RECORD_Update();
+        PROFILE_LoopTick();
 
         /* USER CODE END WHILE */
 
@@ -481,6 +497,11 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+void RPLIDAR_OnRawData(const uint8_t *data, uint16_t length)
+{
+    BRIDGE_AddData(data, length);
+    RECORD_AddData(data, length);
+}
 
 /* USER CODE END 4 */
 
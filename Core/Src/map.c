@@ -15,15 +15,48 @@
 #include "ILI9488.h"
 #include "XPT2046.h"
 #include "buzzer.h"
-
-#define SAMPLE_BUF_SIZE 1024
+#include "profile.h"
+#include "motor.h"
+#include "sweep.h"
+#include "segment.h"
+#include "room.h"
+#include "snap.h"
+#include "cluster.h"
+#include "filter.h"
+#include "match.h"
+#include "tile.h"
+#include "session.h"
+#include "store.h"
+#include "export.h"
+
+#define SAMPLE_BUF_SIZE 1024 // 64 ms at 16000 samples/s, more than the worst sweep match
 #define SAMPLE_QUALITY_DEFAULT 18
-#define POINT_BUF_SIZE 8096
+#define POINT_BUF_SIZE 6144 // Long term map is kept in the tile store
 
 #define MAP_SIZE ILI9488_WIDTH
 #define MAP_DEFAULT_DISTANCE_MAX 1000.0f
 #define MAP_DEFAULT_SCALE ((MAP_SIZE / 2) / MAP_DEFAULT_DISTANCE_MAX)
-#define MAP_PERSISTENCE_ONESHOT_DURATION 2000 //ms
+#define MAP_ACCUMULATE_REVOLUTIONS 10 // Revolutions fused in a snapshot
+#define MAP_CELL_SIZE 2 // px, offsets in the cell are summed on 8 bits so it must stay at 2
+#define MAP_CELL_COLS (MAP_SIZE / MAP_CELL_SIZE + 1)
+#define MAP_CELL_HITS_MAX 255
+#define MAP_CELL_PROBES 16
+#define MAP_CELL_HASH 40503 // Spreads neighbour cells over the table
+#define MAP_HEAT_CELL_SIZE 4 // px
+#define MAP_HEAT_COLS (MAP_SIZE / MAP_HEAT_CELL_SIZE)
+#define MAP_HEAT_HITS_MAX 255
+#define MAP_HEAT_LEVELS 8
+#define MAP_HEAT_DECAY_REVOLUTIONS 10 // Hits are halved this often when the map is not persistent
+#define MAP_HEAT_LOAD_ROWS 4 // Heatmap rows read back from the tiles per main loop iteration
+#define MAP_ROOM_BUDGET_US 1000 // Room estimation time per main loop iteration
+#define MAP_SCALE_HIST_BIN 250 // mm
+#define MAP_SCALE_HIST_SIZE 64 // Up to 16 m
+#define MAP_SCALE_PERCENTILE 98
+#define MAP_SCALE_SHRINK_RATIO 0.75 // Shrink only when the wanted range is this much smaller
+#define MAP_SCALE_SHRINK_REVOLUTIONS 5 // Consecutive revolutions needed to shrink
+#define MAP_REPROJECT_STEP 256 // Points moved per main loop iteration after a scale change
+#define MAP_SNAP_RADIUS_PX 10 // Taps snap to the nearest sample within this radius
+#define MAP_SNAP_RADIUS_MAX 1000 // mm
 
 #define MAP_TOOLBAR_WIDTH ((ILI9488_HEIGHT - ILI9488_WIDTH) / 2)
 
@@ -58,42 +91,149 @@
 #define MAP_BUTTON_PERS_CLEAR_X (ILI9488_HEIGHT - MAP_TOOLBAR_WIDTH + 11)
 #define MAP_BUTTON_PERS_CLEAR_Y (ILI9488_WIDTH - 55)
 #define MAP_BUTTON_PERS_CLEAR_W (MAP_TOOLBAR_WIDTH - 13)
-#define MAP_BUTTON_PERS_CLEAR_H 45
+#define MAP_BUTTON_PERS_CLEAR_H 22
+
+#define MAP_BUTTON_SAVE_X (ILI9488_HEIGHT - MAP_TOOLBAR_WIDTH + 11)
+#define MAP_BUTTON_SAVE_Y (ILI9488_WIDTH - 31)
+#define MAP_BUTTON_SAVE_W 33
+#define MAP_BUTTON_SAVE_H 21
+
+#define MAP_BUTTON_LOAD_X (MAP_BUTTON_SAVE_X + MAP_BUTTON_SAVE_W + 1)
+#define MAP_BUTTON_LOAD_Y (ILI9488_WIDTH - 31)
+#define MAP_BUTTON_LOAD_W 33
+#define MAP_BUTTON_LOAD_H 21
 
 #define MAP_QUALITY_GRADIENT_X (ILI9488_HEIGHT - MAP_TOOLBAR_WIDTH + 15)
 #define MAP_QUALITY_GRADIENT_Y 10
 #define MAP_QUALITY_GRADIENT_W 10
 #define MAP_QUALITY_GRADIENT_H 100
 #define MAP_QUALITY_GRADIENT_NB 10
+#define MAP_QUALITY_LEVELS 64
+
+/* Quality gradient from red to green, written out at compile time so that points are drawn without conversion */
+#define MAP_QUALITY_COLOR(q) rgb666(0xFF - (q) * 4, (q) * 4, 0x00)
+#define MAP_QUALITY_COLORS_4(q) MAP_QUALITY_COLOR(q), MAP_QUALITY_COLOR((q) + 1), MAP_QUALITY_COLOR((q) + 2), \
+        MAP_QUALITY_COLOR((q) + 3)
+#define MAP_QUALITY_COLORS_16(q) MAP_QUALITY_COLORS_4(q), MAP_QUALITY_COLORS_4((q) + 4), \
+        MAP_QUALITY_COLORS_4((q) + 8), MAP_QUALITY_COLORS_4((q) + 12)
 
 typedef struct
 {
     uint16_t x;
     uint16_t y;
-    uint16_t color;
+    uint8_t quality; // 0-63, index in the quality colors
 } point_t;
 
-static const point_t map_center_point = {.x = ILI9488_HEIGHT / 2, .y = ILI9488_WIDTH / 2, .color = WHITE};
+/* Reference and measurement markers drawn over the map */
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t color;
+} marker_t;
+
+/* Accumulation cell, the averaged position and quality become one point once the snapshot is complete */
+typedef struct
+{
+    uint16_t key; // Cell index in the map
+    uint8_t hits; // 0 for an empty cell
+    uint8_t sum_dx; // Pixel offsets in the cell
+    uint8_t sum_dy;
+    uint16_t sum_quality;
+} map_cell_t;
+
+typedef struct
+{
+    int16_t x1;
+    int16_t y1;
+    int16_t x2;
+    int16_t y2;
+} line_t;
+
+static const marker_t map_center_point = {.x = ILI9488_HEIGHT / 2, .y = ILI9488_WIDTH / 2, .color = WHITE};
+static const marker_t map_invalid_marker = {0};
 static const point_t map_invalid_point = {0};
+static const ILI9488_Color_t map_quality_colors[MAP_QUALITY_LEVELS] = {MAP_QUALITY_COLORS_16(0),
+                                                                       MAP_QUALITY_COLORS_16(16),
+                                                                       MAP_QUALITY_COLORS_16(32),
+                                                                       MAP_QUALITY_COLORS_16(48)};
+static const snap_point_t map_center_position = {0};
 
 static rplidar_measurement_t map_sample_buf[SAMPLE_BUF_SIZE];
+static uint32_t map_sample_ts_buf[SAMPLE_BUF_SIZE];
 static uint16_t map_sample_write_idx = 0;
 static uint16_t map_sample_read_idx = 0;
 static uint16_t map_sample_count = 0;
+static uint32_t map_sample_dropped = 0;
+static rplidar_dense_measurements_t map_dense_prev;
+static uint32_t map_dense_prev_ts = 0;
+static bool map_dense_prev_valid = false;
 
-static point_t map_point_buf[POINT_BUF_SIZE] = {0};
+/* Points on the screen, the accumulation cells while a snapshot is being built, or the heatmap hit counts */
+static union
+{
+    point_t points[POINT_BUF_SIZE];
+    map_cell_t cells[POINT_BUF_SIZE * sizeof(point_t) / sizeof(map_cell_t)];
+    uint8_t heat[MAP_HEAT_COLS * MAP_HEAT_COLS];
+} map_buf = {0};
+static point_t *const map_point_buf = map_buf.points;
+static map_cell_t *const map_cells = map_buf.cells;
+static uint8_t *const map_heat = map_buf.heat;
 static uint16_t map_point_idx = 0;
+static uint32_t map_point_writes = 0; // Slots written since boot, a buffer reset counts as a whole buffer
+static uint16_t map_save_idx = 0; // Oldest slot when the save started
+static uint32_t map_save_writes = 0;
+static line_t map_line_buf[SEGMENT_MAX];
+static uint8_t map_line_count = 0;
 
 static uint8_t map_quality_min = SAMPLE_QUALITY_DEFAULT; // 0-63
 static map_scale_mode_e map_scale_mode = MAP_SCALE_AUTO;
 static map_persistence_mode_e map_persistence_mode = MAP_PERSIST_OFF;
-static uint32_t map_persistence_start_tick = 0;
+static map_render_mode_e map_render_mode = MAP_RENDER_POINTS;
+static bool map_tracking = false;
+static bool map_tile_paging = false; // A revolution was completed, the tiles it needs can be paged in
+static float map_pose_x = 0.0f; // Sensor pose in the map frame, identity unless tracking
+static float map_pose_y = 0.0f;
+static float map_pose_cos = 1.0f;
+static float map_pose_sin = 0.0f;
+static bool map_accumulating = false; // Cells are being filled, the point buffer holds them
+static uint8_t map_accumulate_revolutions = 0;
+static uint16_t map_cells_updated = 0;
+static uint32_t map_cells_dropped = 0;
+static uint16_t map_heat_drawn = 0; // Heatmap cells drawn since the start of the revolution
+static uint8_t map_heat_revolutions = 0;
+static uint8_t map_heat_load_row = MAP_HEAT_COLS; // Next row read back from the tiles, MAP_HEAT_COLS when done
+/* One color per power of two of hits, from blind zones to reflective surfaces */
+static const ILI9488_Color_t map_heat_colors[MAP_HEAT_LEVELS] = {rgb666(0x00, 0x00, 0x00), rgb666(0x00, 0x00, 0x80),
+                                                                 rgb666(0x00, 0x00, 0xFF), rgb666(0x00, 0x80, 0xFF),
+                                                                 rgb666(0x00, 0xFF, 0x80), rgb666(0x80, 0xFF, 0x00),
+                                                                 rgb666(0xFF, 0xC0, 0x00), rgb666(0xFF, 0x00, 0x00)};
 static double map_scale_distance_max = MAP_DEFAULT_DISTANCE_MAX;
 static double map_scale_factor = MAP_DEFAULT_SCALE;
-static point_t map_selected_point[2] = {map_invalid_point, map_invalid_point};
+static uint16_t map_scale_hist[MAP_SCALE_HIST_SIZE];
+static uint8_t map_scale_shrink_count = 0;
+static double map_reproject_ratio = 1.0;
+static uint16_t map_reproject_idx = 0;
+static uint16_t map_reproject_remaining = 0;
+static bool map_reproject_cleared = false; // Map area cleared on the scale change, old pixels are already erased
+static marker_t map_selected_point[2] = {map_invalid_marker, map_invalid_marker};
+static snap_point_t map_selected_position[2]; // Selected points in mm from the sensor
 static uint8_t map_selected_point_idx = 0;
-
-static bool _ConvertSampleToPoint(rplidar_measurement_t *sample, point_t *point);
+static bool map_session_failed = false;
+static bool map_scan_running = false;
+
+static void _StartScan(void);
+static void _StopScan(void);
+static void _PushSample(rplidar_measurement_t *measurement, uint32_t timestamp);
+static void _DrawSample(rplidar_measurement_t *sample, uint32_t timestamp);
+static bool _ConvertSampleToPoint(rplidar_measurement_t *sample, point_t *point, snap_point_t *position);
+static void _UpdateAutoScale(void);
+static void _UpdatePose(bool reset);
+static void _SetScaleDistance(double distance_max);
+static void _ReprojectPoints(uint16_t count);
+static bool _IsPointVisible(const point_t *point);
+static bool _ConvertSegmentToLine(const segment_t *segment, line_t *line);
+static void _DrawSegments(void);
 static void _DrawGrid(void);
 static void _DrawMapScale(double scale);
 static void _DrawButtonStart(bool is_started);
@@ -101,13 +241,30 @@ static void _DrawButtonScale(map_scale_mode_e mode);
 static void _DrawQualityGradient(void);
 static void _DrawQualityMinimum(uint8_t quality);
 static void _DrawPersistanceButtons(map_persistence_mode_e mode);
-static void _DrawDistanceInfo(const point_t *p1, const point_t *p2);
-static double _GetDistancePoints(const point_t *p1, const point_t *p2);
+static void _DrawSessionButtons(void);
+static void _DrawDistanceInfo(const marker_t *p1, const snap_point_t *pos1, const marker_t *p2,
+                              const snap_point_t *pos2);
+static void _DrawRoomInfo(void);
+static double _GetDistancePoints(const snap_point_t *p1, const snap_point_t *p2);
+static uint16_t _GetQualityColor(uint8_t quality);
+static const ILI9488_Color_t* _GetQualityRGB666(uint8_t quality);
+static bool _LoadSession(void);
+static void _ResetPointBuffer(void);
+static void _AccumulatePoint(const point_t *point, uint8_t quality);
+static void _RenderCells(void);
+static void _AddHeat(const point_t *point);
+static void _EndHeatRevolution(void);
+static void _DrawHeatmap(void);
+static void _LoadHeat(void);
+static void _LoadHeatRows(uint8_t count);
+static void _DrawHeatCell(uint16_t idx);
+static uint8_t _GetHeatLevel(uint8_t hits);
 
 void MAP_Show(void)
 {
     MAP_SetScaleMode(MAP_SCALE_AUTO);
     MAP_SetQuality(SAMPLE_QUALITY_DEFAULT);
+    SNAP_Reset();
     MAP_DrawMenu();
 }
 
@@ -115,60 +272,65 @@ void MAP_DrawMenu(void)
 {
     ILI9488_FillScreen(BLACK);
     _DrawGrid();
+    if (map_render_mode == MAP_RENDER_HEATMAP)
+    {
+        // The hit counts are kept while another screen is shown
+        _DrawHeatmap();
+    }
     _DrawMapScale(map_scale_distance_max / 5000.0);
     _DrawButtonStart(false);
     _DrawButtonScale(map_scale_mode);
     _DrawQualityGradient();
     _DrawQualityMinimum(map_quality_min);
     _DrawPersistanceButtons(map_persistence_mode);
-    _DrawDistanceInfo(&map_selected_point[0], &map_selected_point[1]);
+    _DrawSessionButtons();
+    _DrawDistanceInfo(&map_selected_point[0], &map_selected_position[0], &map_selected_point[1],
+                      &map_selected_position[1]);
 }
 
 void MAP_DrawSamples(void)
 {
+    if (ROOM_Update(MAP_ROOM_BUDGET_US) && map_selected_point[0].x == map_invalid_marker.x)
+    {
+        // Measurement tool is not used, show the new room estimate in its place
+        _DrawRoomInfo();
+    }
+
+    if (map_reproject_remaining > 0)
+    {
+        _ReprojectPoints(MAP_REPROJECT_STEP);
+    }
+
+    if (map_heat_load_row < MAP_HEAT_COLS)
+    {
+        _LoadHeatRows(MAP_HEAT_LOAD_ROWS);
+    }
+
+    if (map_tile_paging)
+    {
+        // Flash is accessed once per revolution at most, never while drawing the samples
+        map_tile_paging = false;
+        TILE_Update();
+    }
+
+    if (SESSION_Update())
+    {
+        map_session_failed = !SESSION_IsSaved();
+        _DrawSessionButtons();
+    }
+
     while (map_sample_count)
     {
-        point_t new_point;
-        bool is_valid = _ConvertSampleToPoint(&map_sample_buf[map_sample_read_idx], &new_point);
+        cluster_sample_t samples[CLUSTER_SIZE_MAX];
+        uint8_t count = CLUSTER_Process(&map_sample_buf[map_sample_read_idx], map_sample_ts_buf[map_sample_read_idx],
+                                        samples);
         map_sample_read_idx = (map_sample_read_idx + 1) % SAMPLE_BUF_SIZE;
         map_sample_count--;
 
-        if (is_valid)
+        for (uint8_t i = 0; i < count; i++)
         {
-            point_t *point = &map_point_buf[map_point_idx];
-            if (point->x != 0 || point->y != 0)
-            {
-                switch (map_persistence_mode)
-                {
-                    default:
-                    case MAP_PERSIST_OFF:
-                        // Remove old point from the screen
-                        ILI9488_Pixel(point->x, point->y, BLACK);
-                        break;
-                    case MAP_PERSIST_ON:
-                        // Accumulate points on the screen
-                        break;
-                    case MAP_PERSIST_ONESHOT:
-                        // Accumulate points and stop after a specific time
-                        if (map_persistence_start_tick == 0)
-                        {
-                            map_persistence_start_tick = HAL_GetTick();
-                        }
-                        if (HAL_GetTick() - map_persistence_start_tick > MAP_PERSISTENCE_ONESHOT_DURATION /*ms*/)
-                        {
-                            // Immediatly return to not draw the new point
-                            map_point_idx = (map_point_idx + 1) % POINT_BUF_SIZE;
-                            return;
-                        }
-                        break;
-                }
-            }
-
-            *point = new_point;
-
-            // Draw new point
-            ILI9488_Pixel(point->x, point->y, point->color);
-            map_point_idx = (map_point_idx + 1) % POINT_BUF_SIZE;
+            FILTER_Apply(&samples[i].measurement);
+            _DrawSample(&samples[i].measurement, samples[i].timestamp);
         }
     }
 }
@@ -189,17 +351,22 @@ void MAP_Touch(uint16_t x, uint16_t y)
         tick_pressed = tick_cur;
         Buzzer_Play_Menu_Touch();
 
-        static bool running = false;
-        if (running)
+        map_scan_running = !map_scan_running;
+        if (map_scan_running)
         {
-            RPLIDAR_StopScan();
+            _StartScan();
         }
         else
         {
-            RPLIDAR_StartScan(NULL, 0, 0);
+            _StopScan();
+            TILE_Flush();
+            if (SESSION_GetState() == SESSION_STATE_IDLE)
+            {
+                // Nothing is received now, compact the store before the next save rather than during it
+                SESSION_Reserve(POINT_BUF_SIZE);
+            }
         }
-        running = !running;
-        _DrawButtonStart(running);
+        _DrawButtonStart(map_scan_running);
     }
     else if (x >= MAP_BUTTON_SCALE_X && x < MAP_BUTTON_SCALE_X + MAP_BUTTON_SCALE_W && y >= MAP_BUTTON_SCALE_Y
             && y < MAP_BUTTON_SCALE_Y + MAP_BUTTON_SCALE_H)
@@ -283,6 +450,46 @@ void MAP_Touch(uint16_t x, uint16_t y)
 
         MAP_ClearPoints(true);
     }
+    else if (x >= MAP_BUTTON_SAVE_X && x < MAP_BUTTON_SAVE_X + MAP_BUTTON_SAVE_W && y >= MAP_BUTTON_SAVE_Y
+            && y < MAP_BUTTON_SAVE_Y + MAP_BUTTON_SAVE_H)
+    {
+        // Button SAVE pressed
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < MAP_BUTTON_DEBOUNCE_TIMER)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        // Saved in the background while the scan continues
+        session_info_t info = {.scale_mode = map_scale_mode, .quality_min = map_quality_min, .persistence_mode =
+                map_persistence_mode, .render_mode = map_render_mode, .scale_distance = map_scale_distance_max,
+                               .point_count = POINT_BUF_SIZE};
+        if (SESSION_Save(&info))
+        {
+            // The scan keeps overwriting the oldest points while they are saved
+            map_save_idx = map_point_idx;
+            map_save_writes = map_point_writes;
+        }
+        map_session_failed = false;
+        _DrawSessionButtons();
+    }
+    else if (x >= MAP_BUTTON_LOAD_X && x < MAP_BUTTON_LOAD_X + MAP_BUTTON_LOAD_W && y >= MAP_BUTTON_LOAD_Y
+            && y < MAP_BUTTON_LOAD_Y + MAP_BUTTON_LOAD_H)
+    {
+        // Button LOAD pressed
+        static uint32_t tick_pressed = 0;
+        if (tick_cur - tick_pressed < MAP_BUTTON_DEBOUNCE_TIMER || SESSION_GetState() != SESSION_STATE_IDLE)
+        {
+            return;
+        }
+        tick_pressed = tick_cur;
+        Buzzer_Play_Menu_Touch();
+
+        map_session_failed = !_LoadSession();
+        _DrawSessionButtons();
+    }
     else if (x >= MAP_TOOLBAR_WIDTH && x <= (MAP_TOOLBAR_WIDTH + MAP_SIZE))
     {
         // Press on RADAR area
@@ -302,11 +509,28 @@ void MAP_Touch(uint16_t x, uint16_t y)
             ILI9488_FillCircle(map_center_point.x, map_center_point.y, 3, map_center_point.color);
         }
 
+        // Snap to the nearest sample to measure from its millimetre position instead of the pixel
+        snap_point_t *position = &map_selected_position[map_selected_point_idx];
+        snap_point_t target;
+        target.x = (x - ILI9488_HEIGHT / 2) / map_scale_factor;
+        target.y = (y - ILI9488_WIDTH / 2) / map_scale_factor;
+        double radius = MAP_SNAP_RADIUS_PX / map_scale_factor;
+        if (SNAP_FindNearest(&target, radius < MAP_SNAP_RADIUS_MAX ? radius : MAP_SNAP_RADIUS_MAX, position))
+        {
+            x = position->x * map_scale_factor + ILI9488_HEIGHT / 2;
+            y = position->y * map_scale_factor + ILI9488_WIDTH / 2;
+        }
+        else
+        {
+            *position = target;
+        }
+
         map_selected_point[map_selected_point_idx].x = x;
         map_selected_point[map_selected_point_idx].y = y;
         map_selected_point[map_selected_point_idx].color = map_selected_point_idx == 0 ? BLUE : CYAN;
         ILI9488_FillCircle(x, y, 3, map_selected_point[map_selected_point_idx].color);
-        _DrawDistanceInfo(&map_selected_point[0], &map_selected_point[1]);
+        _DrawDistanceInfo(&map_selected_point[0], &map_selected_position[0], &map_selected_point[1],
+                          &map_selected_position[1]);
         map_selected_point_idx = (map_selected_point_idx + 1) % 2;
     }
 }
@@ -316,20 +540,40 @@ void MAP_ClearPoints(bool erase_buffers)
     // Erase all points from screen and redraw grid
     ILI9488_FillArea(MAP_TOOLBAR_WIDTH, 0, MAP_SIZE, ILI9488_WIDTH, BLACK);
     _DrawGrid();
-    map_selected_point[0] = map_invalid_point;
-    map_selected_point[1] = map_invalid_point;
-    _DrawDistanceInfo(&map_selected_point[0], &map_selected_point[1]);
-    map_persistence_start_tick = 0;
+    map_selected_point[0] = map_invalid_marker;
+    map_selected_point[1] = map_invalid_marker;
+    _DrawDistanceInfo(&map_selected_point[0], &map_selected_position[0], &map_selected_point[1],
+                      &map_selected_position[1]);
+    map_line_count = 0;
+    map_reproject_remaining = 0;
 
     if (erase_buffers)
     {
         // Empty all buffers
         memset(&map_point_buf[0], 0, sizeof(point_t) * POINT_BUF_SIZE);
         map_point_idx = 0;
+        map_point_writes += POINT_BUF_SIZE;
 
         memset(&map_sample_buf[0], 0, sizeof(rplidar_measurement_t) * SAMPLE_BUF_SIZE);
         map_sample_write_idx = 0;
         map_sample_count = 0;
+        map_dense_prev_valid = false;
+        CLUSTER_Reset();
+        FILTER_Reset();
+        SWEEP_Reset();
+        ROOM_Reset();
+        SNAP_Reset();
+    }
+
+    if (map_persistence_mode == MAP_PERSIST_ACCUMULATE || map_render_mode == MAP_RENDER_HEATMAP)
+    {
+        // Start a new snapshot or heatmap, the screen no longer shows the previous one
+        _ResetPointBuffer();
+        if (!erase_buffers && map_render_mode == MAP_RENDER_HEATMAP)
+        {
+            // Only the screen is cleared, the heatmap is drawn again from the tiles
+            _LoadHeat();
+        }
     }
 }
 
@@ -339,9 +583,11 @@ void MAP_SetScaleMode(map_scale_mode_e mode)
     {
         default:
         case MAP_SCALE_AUTO:
-            // Will be auto adjusted based on the longest sample distance
+            // Will be auto adjusted based on the distances of each revolution
             map_scale_distance_max = MAP_DEFAULT_DISTANCE_MAX;
             map_scale_factor = MAP_DEFAULT_SCALE;
+            memset(map_scale_hist, 0, sizeof(map_scale_hist));
+            map_scale_shrink_count = 0;
             break;
         case MAP_SCALE_1000:
             map_scale_distance_max = 1000.0;
@@ -361,6 +607,7 @@ void MAP_SetScaleMode(map_scale_mode_e mode)
             break;
     }
     map_scale_mode = mode;
+    map_reproject_remaining = 0;
 }
 
 void MAP_SetQuality(uint8_t quality)
@@ -370,48 +617,580 @@ void MAP_SetQuality(uint8_t quality)
 
 void MAP_SetPersistanceMode(map_persistence_mode_e mode)
 {
+    bool was_accumulating = map_persistence_mode == MAP_PERSIST_ACCUMULATE;
+
     map_persistence_mode = mode;
+    if (was_accumulating || mode == MAP_PERSIST_ACCUMULATE || map_render_mode == MAP_RENDER_HEATMAP)
+    {
+        // The point buffer holds cells, a snapshot or hit counts, start again from an empty one
+        _ResetPointBuffer();
+    }
+}
+
+void MAP_SetRenderMode(map_render_mode_e mode)
+{
+    bool was_heatmap = map_render_mode == MAP_RENDER_HEATMAP;
+
+    map_render_mode = mode;
+    map_line_count = 0;
+    if (was_heatmap != (mode == MAP_RENDER_HEATMAP))
+    {
+        // Points and hit counts share the buffer
+        _ResetPointBuffer();
+        if (mode == MAP_RENDER_HEATMAP)
+        {
+            _LoadHeat();
+        }
+    }
+}
+
+map_render_mode_e MAP_GetRenderMode(void)
+{
+    return map_render_mode;
+}
+
+void MAP_SetTracking(bool enable)
+{
+    // The position where tracking starts is the origin of the map
+    MATCH_Reset();
+    if (enable)
+    {
+        TILE_Reset();
+    }
+    _UpdatePose(true);
+    map_tracking = enable;
+}
+
+bool MAP_IsTracking(void)
+{
+    return map_tracking;
+}
+
+void MAP_GetStats(map_stats_t *stats)
+{
+    stats->sample_count = map_sample_count;
+    stats->sample_capacity = SAMPLE_BUF_SIZE;
+    stats->sample_dropped = map_sample_dropped;
+    stats->cells_updated = map_cells_updated;
+    stats->cells_dropped = map_cells_dropped;
 }
 
 void RPLIDAR_OnSingleMeasurement(rplidar_measurement_t *measurement)
 {
-    if (map_sample_count < SAMPLE_BUF_SIZE)
+    _PushSample(measurement, RPLIDAR_GetMeasurementTimestamp());
+}
+
+void RPLIDAR_OnDenseMeasurements(rplidar_dense_measurements_t *measurement)
+{
+    rplidar_measurement_t samples[sizeof(measurement->distance) / sizeof(measurement->distance[0])];
+    uint32_t timestamps[sizeof(measurement->distance) / sizeof(measurement->distance[0])];
+    uint32_t timestamp = RPLIDAR_GetMeasurementTimestamp();
+
+    // Samples angles are interpolated with the next capsule, so decode the previous capsule
+    if (map_dense_prev_valid)
+    {
+        uint8_t count = RPLIDAR_DecodeDenseCapsule(&map_dense_prev, measurement, samples, map_dense_prev_ts,
+                                                   timestamp, timestamps);
+        for (uint8_t i = 0; i < count; i++)
+        {
+            _PushSample(&samples[i], timestamps[i]);
+        }
+    }
+    memcpy(&map_dense_prev, measurement, sizeof(rplidar_dense_measurements_t));
+    map_dense_prev_ts = timestamp;
+    map_dense_prev_valid = true;
+}
+
+bool SESSION_OnSavePoint(uint16_t index, session_point_t *point)
+{
+    // Oldest point first so that the ring order is kept when loading
+    const point_t *saved = &map_point_buf[(map_save_idx + index) % POINT_BUF_SIZE];
+
+    if (map_point_writes - map_save_writes > index)
+    {
+        // Slot already holds a newer point, the following ones would be duplicates
+        return false;
+    }
+    if (map_accumulating || map_render_mode == MAP_RENDER_HEATMAP)
+    {
+        // Snapshot not complete or heatmap, the buffer holds cells or hit counts
+        *point = (session_point_t) {0};
+        return true;
+    }
+    point->x = saved->x;
+    point->y = saved->y;
+    point->quality = saved->quality;
+    return true;
+}
+
+void SESSION_OnLoadPoint(const session_point_t *point)
+{
+    point_t *loaded = &map_point_buf[map_point_idx];
+
+    if (map_render_mode == MAP_RENDER_HEATMAP)
     {
-        if ((measurement->distance != 0) && (measurement->quality >= map_quality_min))
+        // The buffer holds the hit counts, only the cell of the point is updated
+        point_t heat_point = {.x = point->x, .y = point->y};
+        if (_IsPointVisible(&heat_point))
+        {
+            _AddHeat(&heat_point);
+        }
+        return;
+    }
+
+    loaded->x = point->x;
+    loaded->y = point->y;
+    loaded->quality = point->quality;
+    if (!_IsPointVisible(loaded))
+    {
+        *loaded = map_invalid_point;
+        return;
+    }
+
+    if (map_render_mode == MAP_RENDER_POINTS)
+    {
+        ILI9488_PixelRGB666(loaded->x, loaded->y, _GetQualityRGB666(loaded->quality));
+    }
+    map_point_idx = (map_point_idx + 1) % POINT_BUF_SIZE;
+    map_point_writes++;
+}
+
+void STORE_OnEraseStart(void)
+{
+    // The CPU stalls for up to 2 s, the lidar would overflow the receive buffer meanwhile
+    if (map_scan_running)
+    {
+        _StopScan();
+    }
+}
+
+void STORE_OnEraseEnd(void)
+{
+    if (map_scan_running)
+    {
+        _StartScan();
+    }
+}
+
+static void _StartScan(void)
+{
+    map_dense_prev_valid = false;
+    CLUSTER_Reset();
+    RPLIDAR_StartSelectedScan();
+    MOTOR_Enable(true);
+}
+
+static void _StopScan(void)
+{
+    MOTOR_Enable(false);
+    RPLIDAR_StopScan();
+}
+
+static void _PushSample(rplidar_measurement_t *measurement, uint32_t timestamp)
+{
+    if ((measurement->distance != 0) && (measurement->quality >= map_quality_min))
+    {
+        // Filter only valid and good quality measurement
+        if (map_sample_count < SAMPLE_BUF_SIZE)
         {
-            // Filter only valid and good quality measurement
             memcpy(&map_sample_buf[map_sample_write_idx], measurement, sizeof(rplidar_measurement_t));
+            map_sample_ts_buf[map_sample_write_idx] = timestamp;
             map_sample_write_idx = (map_sample_write_idx + 1) % SAMPLE_BUF_SIZE;
             map_sample_count++;
         }
+        else
+        {
+            // Display is not draining the samples fast enough
+            map_sample_dropped++;
+        }
+    }
+}
+
+static void _DrawSample(rplidar_measurement_t *sample, uint32_t timestamp)
+{
+    point_t new_point;
+    snap_point_t new_position;
+
+    if (SWEEP_AddSample(sample, timestamp))
+    {
+        // Scale is updated first so that the new revolution is drawn with it
+        if (map_scale_mode == MAP_SCALE_AUTO)
+        {
+            _UpdateAutoScale();
+        }
+        ROOM_AddSweep(SWEEP_GetFrame());
+        EXPORT_AddSweep(SWEEP_GetFrame());
+        // The samples received meanwhile wait in the sample buffer, the worst match takes about 45 ms
+        if (map_tracking && MATCH_AddSweep(SWEEP_GetFrame()))
+        {
+            _UpdatePose(false);
+        }
+        map_tile_paging = map_tracking;
+        if (map_render_mode == MAP_RENDER_LINES)
+        {
+            _DrawSegments();
+        }
+        if (map_render_mode == MAP_RENDER_HEATMAP)
+        {
+            _EndHeatRevolution();
+        }
+        if (map_persistence_mode == MAP_PERSIST_ACCUMULATE && map_accumulate_revolutions < MAP_ACCUMULATE_REVOLUTIONS
+                && ++map_accumulate_revolutions == MAP_ACCUMULATE_REVOLUTIONS && map_accumulating)
+        {
+            _RenderCells();
+        }
+    }
+
+    PROFILE_BEGIN(PROFILE_ZONE_CONVERT_SAMPLE);
+    bool is_valid = _ConvertSampleToPoint(sample, &new_point, &new_position);
+    PROFILE_END(PROFILE_ZONE_CONVERT_SAMPLE);
+
+    if (map_tracking)
+    {
+        // Whole map in the fixed frame, including the samples outside of the screen
+        TILE_AddPoint(new_position.x, new_position.y, sample->distance / 4);
+    }
+
+    if (is_valid)
+    {
+        // Index the displayed samples so taps can snap to them
+        SNAP_AddPoint(&new_position);
+    }
+
+    if (is_valid && map_render_mode == MAP_RENDER_HEATMAP)
+    {
+        if (map_persistence_mode != MAP_PERSIST_ACCUMULATE || map_accumulate_revolutions < MAP_ACCUMULATE_REVOLUTIONS)
+        {
+            _AddHeat(&new_point);
+        }
+    }
+    else if (is_valid && map_render_mode == MAP_RENDER_POINTS && map_persistence_mode == MAP_PERSIST_ACCUMULATE)
+    {
+        if (map_accumulating)
+        {
+            _AccumulatePoint(&new_point, sample->quality);
+        }
+        // Nothing is drawn until the snapshot is complete, then the samples are still consumed but ignored
+    }
+    else if (is_valid && map_render_mode == MAP_RENDER_POINTS)
+    {
+        point_t *point = &map_point_buf[map_point_idx];
+        if (point->x != 0 || point->y != 0)
+        {
+            switch (map_persistence_mode)
+            {
+                default:
+                case MAP_PERSIST_OFF:
+                    // Remove old point from the screen
+                    ILI9488_Pixel(point->x, point->y, BLACK);
+                    break;
+                case MAP_PERSIST_ON:
+                    // Accumulate points on the screen
+                    break;
+            }
+        }
+
+        *point = new_point;
+        if (map_reproject_remaining > 0)
+        {
+            // Oldest point replaced at the new scale, no need to move it anymore
+            map_reproject_remaining--;
+        }
+
+        // Draw new point
+        ILI9488_PixelRGB666(point->x, point->y, _GetQualityRGB666(point->quality));
+        map_point_idx = (map_point_idx + 1) % POINT_BUF_SIZE;
+        map_point_writes++;
     }
 }
 
-static bool _ConvertSampleToPoint(rplidar_measurement_t *sample, point_t *point)
+static bool _ConvertSampleToPoint(rplidar_measurement_t *sample, point_t *point, snap_point_t *position)
 {
     double distance_mm = sample->distance / 4.0;
     double angle_rad = (sample->angle / 64.0) * M_PI / 180;
-    double y = -distance_mm * cosf(angle_rad);
-    double x = distance_mm * sinf(angle_rad);
+    double sensor_y = -distance_mm * cosf(angle_rad);
+    double sensor_x = distance_mm * sinf(angle_rad);
+    double x = map_pose_cos * sensor_x - map_pose_sin * sensor_y + map_pose_x;
+    double y = map_pose_sin * sensor_x + map_pose_cos * sensor_y + map_pose_y;
 
     if (map_scale_mode == MAP_SCALE_AUTO)
     {
-        if (distance_mm > map_scale_distance_max)
-        {
-            map_scale_distance_max = distance_mm;
-            map_scale_factor = ((MAP_SIZE / 2) / map_scale_distance_max);
-            _DrawMapScale(map_scale_distance_max / 5000.0);
-            MAP_ClearPoints(false);
-        }
+        // Auto scale is computed once per revolution from the distance distribution
+        uint16_t bin = (uint32_t) distance_mm / MAP_SCALE_HIST_BIN;
+        map_scale_hist[bin < MAP_SCALE_HIST_SIZE ? bin : MAP_SCALE_HIST_SIZE - 1]++;
     }
 
     point->x = x * map_scale_factor + ILI9488_HEIGHT / 2;
     point->y = y * map_scale_factor + ILI9488_WIDTH / 2;
-    point->color = color565(0xFF - (sample->quality * 4), sample->quality * 4, 0x00); // Quality range:  0-63
+    point->quality = sample->quality;
+    position->x = lround(x);
+    position->y = lround(y);
+
+    return _IsPointVisible(point);
+}
+
+/* Samples are placed in the map frame with the pose of their sweep */
+static void _UpdatePose(bool reset)
+{
+    match_pose_t pose = {0};
 
+    if (!reset)
+    {
+        MATCH_GetPose(&pose);
+    }
+    map_pose_x = pose.x;
+    map_pose_y = pose.y;
+    map_pose_cos = cosf(pose.theta);
+    map_pose_sin = sinf(pose.theta);
+}
+
+/* Fit the map to the percentile of the last revolution distances, ignoring the farthest outliers */
+static void _UpdateAutoScale(void)
+{
+    uint32_t total = 0;
+    uint32_t cumulated = 0;
+    uint8_t bin = 0;
+
+    for (uint8_t i = 0; i < MAP_SCALE_HIST_SIZE; i++)
+    {
+        total += map_scale_hist[i];
+    }
+    if (total == 0)
+    {
+        return;
+    }
+    for (bin = 0; bin < MAP_SCALE_HIST_SIZE - 1; bin++)
+    {
+        cumulated += map_scale_hist[bin];
+        if (cumulated * 100 >= total * MAP_SCALE_PERCENTILE)
+        {
+            break;
+        }
+    }
+    memset(map_scale_hist, 0, sizeof(map_scale_hist));
+
+    // Upper edge of the bin plus one bin of margin
+    double distance_max = (bin + 2) * MAP_SCALE_HIST_BIN;
+    if (distance_max < MAP_DEFAULT_DISTANCE_MAX)
+    {
+        distance_max = MAP_DEFAULT_DISTANCE_MAX;
+    }
+
+    if (distance_max > map_scale_distance_max)
+    {
+        map_scale_shrink_count = 0;
+        _SetScaleDistance(distance_max);
+    }
+    else if (distance_max < map_scale_distance_max * MAP_SCALE_SHRINK_RATIO)
+    {
+        // Hysteresis, the room must look smaller for several revolutions
+        if (++map_scale_shrink_count >= MAP_SCALE_SHRINK_REVOLUTIONS)
+        {
+            map_scale_shrink_count = 0;
+            _SetScaleDistance(distance_max);
+        }
+    }
+    else
+    {
+        map_scale_shrink_count = 0;
+    }
+}
+
+/* Change the scale and move the drawn points instead of clearing the map */
+static void _SetScaleDistance(double distance_max)
+{
+    double scale_factor = (MAP_SIZE / 2) / distance_max;
+
+    if (map_render_mode == MAP_RENDER_HEATMAP)
+    {
+        // Hit counts cannot be moved, start the heatmap again from the tiles
+        _ResetPointBuffer();
+        _LoadHeat();
+        ILI9488_FillArea(MAP_TOOLBAR_WIDTH, 0, MAP_SIZE, ILI9488_WIDTH, BLACK);
+        _DrawGrid();
+    }
+    else if (map_accumulating)
+    {
+        // Cells are at the previous scale and are not points, start the snapshot again
+        _ResetPointBuffer();
+    }
+    else
+    {
+        if (map_reproject_remaining > 0)
+        {
+            // Finish the previous change so that all points are at the same scale
+            _ReprojectPoints(map_reproject_remaining);
+        }
+
+        // Pixels of the points already evicted from the buffer cannot be moved, clear them with the others
+        map_reproject_cleared = (map_persistence_mode == MAP_PERSIST_ON);
+        if (map_reproject_cleared)
+        {
+            ILI9488_FillArea(MAP_TOOLBAR_WIDTH, 0, MAP_SIZE, ILI9488_WIDTH, BLACK);
+            _DrawGrid();
+        }
+
+        // Points are moved from the newest to the oldest, the oldest ones are replaced by new samples meanwhile
+        map_reproject_ratio = scale_factor / map_scale_factor;
+        map_reproject_idx = map_point_idx;
+        map_reproject_remaining = POINT_BUF_SIZE;
+    }
+
+    // Measurement markers follow the scale, their millimetre positions are unchanged
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        if (map_selected_point[i].x != map_invalid_marker.x)
+        {
+            ILI9488_FillCircle(map_selected_point[i].x, map_selected_point[i].y, 3, BLACK);
+            map_selected_point[i].x = map_selected_position[i].x * scale_factor + ILI9488_HEIGHT / 2;
+            map_selected_point[i].y = map_selected_position[i].y * scale_factor + ILI9488_WIDTH / 2;
+            ILI9488_FillCircle(map_selected_point[i].x, map_selected_point[i].y, 3, map_selected_point[i].color);
+        }
+    }
+
+    map_scale_distance_max = distance_max;
+    map_scale_factor = scale_factor;
+    _DrawMapScale(map_scale_distance_max / 5000.0);
+    ILI9488_FillCircle(map_center_point.x, map_center_point.y, 3, map_center_point.color);
+}
+
+static void _ReprojectPoints(uint16_t count)
+{
+    while (count-- > 0 && map_reproject_remaining > 0)
+    {
+        map_reproject_idx = (map_reproject_idx + POINT_BUF_SIZE - 1) % POINT_BUF_SIZE;
+        map_reproject_remaining--;
+
+        point_t *point = &map_point_buf[map_reproject_idx];
+        if (point->x == 0 && point->y == 0)
+        {
+            continue;
+        }
+
+        if (!map_reproject_cleared)
+        {
+            ILI9488_Pixel(point->x, point->y, BLACK);
+        }
+        int32_t x = lround((point->x - ILI9488_HEIGHT / 2) * map_reproject_ratio) + ILI9488_HEIGHT / 2;
+        int32_t y = lround((point->y - ILI9488_WIDTH / 2) * map_reproject_ratio) + ILI9488_WIDTH / 2;
+        if (x >= 0 && y >= 0)
+        {
+            point->x = x;
+            point->y = y;
+        }
+        if (x >= 0 && y >= 0 && _IsPointVisible(point))
+        {
+            ILI9488_PixelRGB666(point->x, point->y, _GetQualityRGB666(point->quality));
+        }
+        else
+        {
+            *point = map_invalid_point;
+        }
+    }
+}
+
+static bool _IsPointVisible(const point_t *point)
+{
     return (point->x >= MAP_TOOLBAR_WIDTH) && (point->x <= (MAP_TOOLBAR_WIDTH + MAP_SIZE)) && (point->y <= MAP_SIZE);
 }
 
+/* Convert a segment to screen coordinates, clipped to the map area (Liang-Barsky) */
+static bool _ConvertSegmentToLine(const segment_t *segment, line_t *line)
+{
+    float sx = segment->x2 - segment->x1;
+    float sy = segment->y2 - segment->y1;
+    float x1 = (map_pose_cos * segment->x1 - map_pose_sin * segment->y1 + map_pose_x) * map_scale_factor
+            + ILI9488_HEIGHT / 2;
+    float y1 = (map_pose_sin * segment->x1 + map_pose_cos * segment->y1 + map_pose_y) * map_scale_factor
+            + ILI9488_WIDTH / 2;
+    float dx = (map_pose_cos * sx - map_pose_sin * sy) * map_scale_factor;
+    float dy = (map_pose_sin * sx + map_pose_cos * sy) * map_scale_factor;
+    const float p[4] = {-dx, dx, -dy, dy};
+    const float q[4] = {x1 - MAP_TOOLBAR_WIDTH, (MAP_TOOLBAR_WIDTH + MAP_SIZE - 1) - x1, y1, (MAP_SIZE - 1) - y1};
+    float t_min = 0.0f, t_max = 1.0f;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        if (p[i] == 0.0f)
+        {
+            if (q[i] < 0.0f)
+            {
+                // Parallel to this edge and outside
+                return false;
+            }
+        }
+        else
+        {
+            float t = q[i] / p[i];
+            if (p[i] < 0.0f && t > t_min)
+            {
+                t_min = t;
+            }
+            else if (p[i] > 0.0f && t < t_max)
+            {
+                t_max = t;
+            }
+        }
+    }
+    if (t_min > t_max)
+    {
+        return false;
+    }
+
+    line->x1 = x1 + t_min * dx;
+    line->y1 = y1 + t_min * dy;
+    line->x2 = x1 + t_max * dx;
+    line->y2 = y1 + t_max * dy;
+    return true;
+}
+
+/* Replace the drawn walls by the segments of the last sweep */
+static void _DrawSegments(void)
+{
+    uint8_t count;
+    const segment_t *segments;
+
+    switch (map_persistence_mode)
+    {
+        default:
+        case MAP_PERSIST_OFF:
+            // Erase the previous walls and restore the grid they may have crossed
+            for (uint8_t i = 0; i < map_line_count; i++)
+            {
+                ILI9488_DrawLine(map_line_buf[i].x1, map_line_buf[i].y1, map_line_buf[i].x2, map_line_buf[i].y2,
+                BLACK);
+            }
+            if (map_line_count > 0)
+            {
+                _DrawGrid();
+            }
+            break;
+        case MAP_PERSIST_ON:
+            break;
+        case MAP_PERSIST_ACCUMULATE:
+            // Walls of the first revolutions are kept, then the snapshot is frozen
+            if (map_accumulate_revolutions >= MAP_ACCUMULATE_REVOLUTIONS)
+            {
+                return;
+            }
+            break;
+    }
+
+    SEGMENT_Extract(SWEEP_GetFrame());
+    segments = SEGMENT_GetSegments(&count);
+
+    map_line_count = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        line_t *line = &map_line_buf[map_line_count];
+        if (_ConvertSegmentToLine(&segments[i], line))
+        {
+            ILI9488_DrawLine(line->x1, line->y1, line->x2, line->y2, _GetQualityColor(segments[i].quality));
+            map_line_count++;
+        }
+    }
+}
+
 static void _DrawGrid(void)
 {
     // Draw center reference point
@@ -545,8 +1324,8 @@ static void _DrawPersistanceButtons(map_persistence_mode_e mode)
         case MAP_PERSIST_ON:
             str = "ON";
             break;
-        case MAP_PERSIST_ONESHOT:
-            str = "SHOT";
+        case MAP_PERSIST_ACCUMULATE:
+            str = "ACCU";
             break;
     }
 
@@ -563,33 +1342,59 @@ static void _DrawPersistanceButtons(map_persistence_mode_e mode)
 
     ILI9488_CString(MAP_BUTTON_PERS_CLEAR_X, MAP_BUTTON_PERS_CLEAR_Y,
     ILI9488_HEIGHT - 4,
-                    ILI9488_WIDTH - 11, "CLEAR", Font16, 1, WHITE,
+                    MAP_BUTTON_PERS_CLEAR_Y + MAP_BUTTON_PERS_CLEAR_H - 1, "CLEAR", Font16, 1, WHITE,
                     ORANGE);
     ILI9488_DrawBorder(MAP_BUTTON_PERS_CLEAR_X, MAP_BUTTON_PERS_CLEAR_Y,
     MAP_BUTTON_PERS_CLEAR_W,
                        MAP_BUTTON_PERS_CLEAR_H, 2, WHITE);
 }
 
-static void _DrawDistanceInfo(const point_t *p1, const point_t *p2)
+static void _DrawSessionButtons(void)
+{
+    const char *str = "SAVE";
+    uint16_t color = D_GREEN;
+
+    if (SESSION_GetState() != SESSION_STATE_IDLE)
+    {
+        str = "...";
+        color = DD_GREEN;
+    }
+    else if (map_session_failed)
+    {
+        str = "ERR";
+        color = RED;
+    }
+
+    ILI9488_CString(MAP_BUTTON_SAVE_X, MAP_BUTTON_SAVE_Y, MAP_BUTTON_SAVE_X + MAP_BUTTON_SAVE_W - 1,
+                    MAP_BUTTON_SAVE_Y + MAP_BUTTON_SAVE_H - 1, str, Font12, 1, WHITE, color);
+    ILI9488_DrawBorder(MAP_BUTTON_SAVE_X, MAP_BUTTON_SAVE_Y, MAP_BUTTON_SAVE_W, MAP_BUTTON_SAVE_H, 2, WHITE);
+
+    ILI9488_CString(MAP_BUTTON_LOAD_X, MAP_BUTTON_LOAD_Y, MAP_BUTTON_LOAD_X + MAP_BUTTON_LOAD_W - 1,
+                    MAP_BUTTON_LOAD_Y + MAP_BUTTON_LOAD_H - 1, "LOAD", Font12, 1, WHITE, BLUE);
+    ILI9488_DrawBorder(MAP_BUTTON_LOAD_X, MAP_BUTTON_LOAD_Y, MAP_BUTTON_LOAD_W, MAP_BUTTON_LOAD_H, 2, WHITE);
+}
+
+static void _DrawDistanceInfo(const marker_t *p1, const snap_point_t *pos1, const marker_t *p2,
+                              const snap_point_t *pos2)
 {
     char dist_mm[10];
 
     ILI9488_CString(0, 130, MAP_TOOLBAR_WIDTH, 130, "METER", Font16, 1, WHITE,
     BLACK);
 
-    if (p1->x != map_invalid_point.x)
+    if (p1->x != map_invalid_marker.x)
     {
         // Draw distance from center
         ILI9488_FillCircle(12, 159, 3, map_center_point.color);
         ILI9488_CString(0, 153, MAP_TOOLBAR_WIDTH, 153, "<->", Font16, 1, WHITE,
         BLACK);
         ILI9488_FillCircle(MAP_TOOLBAR_WIDTH - 12, 159, 3, p1->color);
-        snprintf(dist_mm, sizeof(dist_mm), "%lu mm", (uint32_t) _GetDistancePoints(&map_center_point, p1));
+        snprintf(dist_mm, sizeof(dist_mm), "%lu mm", (uint32_t) _GetDistancePoints(&map_center_position, pos1));
         ILI9488_CString(0, 170, MAP_TOOLBAR_WIDTH, 182, dist_mm, Font12, 1,
         WHITE,
                         BLACK);
 
-        if (p2->x != map_invalid_point.x)
+        if (p2->x != map_invalid_marker.x)
         {
             // Draw distance from center
             ILI9488_FillCircle(12, 195, 3, map_center_point.color);
@@ -597,7 +1402,7 @@ static void _DrawDistanceInfo(const point_t *p1, const point_t *p2)
             WHITE,
                             BLACK);
             ILI9488_FillCircle(MAP_TOOLBAR_WIDTH - 12, 195, 3, p2->color);
-            snprintf(dist_mm, sizeof(dist_mm), "%lu mm", (uint32_t) _GetDistancePoints(&map_center_point, p2));
+            snprintf(dist_mm, sizeof(dist_mm), "%lu mm", (uint32_t) _GetDistancePoints(&map_center_position, pos2));
             ILI9488_CString(0, 205, MAP_TOOLBAR_WIDTH, 217, dist_mm, Font12, 1,
             WHITE,
                             BLACK);
@@ -608,7 +1413,7 @@ static void _DrawDistanceInfo(const point_t *p1, const point_t *p2)
             WHITE,
                             BLACK);
             ILI9488_FillCircle(MAP_TOOLBAR_WIDTH - 12, 230, 3, p2->color);
-            snprintf(dist_mm, sizeof(dist_mm), "%lu mm", (uint32_t) _GetDistancePoints(p1, p2));
+            snprintf(dist_mm, sizeof(dist_mm), "%lu mm", (uint32_t) _GetDistancePoints(pos1, pos2));
             ILI9488_CString(0, 240, MAP_TOOLBAR_WIDTH, 252, dist_mm, Font12, 1,
             WHITE,
                             BLACK);
@@ -621,11 +1426,282 @@ static void _DrawDistanceInfo(const point_t *p1, const point_t *p2)
     else
     {
         ILI9488_FillArea(0, 150, MAP_TOOLBAR_WIDTH, 100, BLACK);
+        _DrawRoomInfo();
     }
 }
 
+static void _DrawRoomInfo(void)
+{
+    char str[12];
+    const room_t *room = ROOM_Get();
+
+    if (room == NULL)
+    {
+        return;
+    }
+
+    ILI9488_CString(0, 153, MAP_TOOLBAR_WIDTH, 153, "ROOM", Font16, 1, WHITE, BLACK);
+    snprintf(str, sizeof(str), "W %u.%02u m", room->width / 1000, (room->width % 1000) / 10);
+    ILI9488_CString(0, 175, MAP_TOOLBAR_WIDTH, 187, str, Font12, 1, WHITE, BLACK);
+    snprintf(str, sizeof(str), "D %u.%02u m", room->depth / 1000, (room->depth % 1000) / 10);
+    ILI9488_CString(0, 195, MAP_TOOLBAR_WIDTH, 207, str, Font12, 1, WHITE, BLACK);
+    snprintf(str, sizeof(str), "A %lu.%lu m2", room->area / 10000, (room->area % 10000) / 1000);
+    ILI9488_CString(0, 215, MAP_TOOLBAR_WIDTH, 227, str, Font12, 1, WHITE, BLACK);
+}
+
 /* Return distance in mm */
-static double _GetDistancePoints(const point_t *p1, const point_t *p2)
+static double _GetDistancePoints(const snap_point_t *p1, const snap_point_t *p2)
+{
+    return sqrt(pow(p2->x - p1->x, 2) + pow(p2->y - p1->y, 2));
+}
+
+/* RGB565 of the quality color, for the drawing functions without an RGB666 variant */
+static uint16_t _GetQualityColor(uint8_t quality)
+{
+    const ILI9488_Color_t *color = _GetQualityRGB666(quality);
+
+    return color565(color->red, color->green, color->blue);
+}
+
+static const ILI9488_Color_t* _GetQualityRGB666(uint8_t quality)
+{
+    // Quality range: 0-63
+    return &map_quality_colors[quality & (MAP_QUALITY_LEVELS - 1)];
+}
+
+static bool _LoadSession(void)
+{
+    session_info_t info;
+
+    if (!SESSION_GetInfo(&info) || info.scale_mode >= MAP_SCALE_MAX || info.persistence_mode >= MAP_PERSIST_MAX
+            || info.render_mode >= MAP_RENDER_MAX || info.scale_distance == 0)
+    {
+        return false;
+    }
+
+    // Settings first, the saved points are screen positions at the saved scale
+    MAP_SetScaleMode(info.scale_mode);
+    map_scale_distance_max = info.scale_distance;
+    map_scale_factor = (MAP_SIZE / 2) / map_scale_distance_max;
+    MAP_SetQuality(info.quality_min);
+    MAP_SetPersistanceMode(info.persistence_mode);
+    MAP_SetRenderMode(info.render_mode);
+
+    _DrawMapScale(map_scale_distance_max / 5000.0);
+    _DrawButtonScale(map_scale_mode);
+    _DrawQualityMinimum(map_quality_min);
+    _DrawPersistanceButtons(map_persistence_mode);
+    MAP_ClearPoints(true);
+    if (map_persistence_mode == MAP_PERSIST_ACCUMULATE && map_render_mode != MAP_RENDER_HEATMAP)
+    {
+        // The saved points are the snapshot
+        map_accumulating = false;
+        map_accumulate_revolutions = MAP_ACCUMULATE_REVOLUTIONS;
+    }
+
+    return SESSION_Load();
+}
+
+/* The buffer is shared by the points, the accumulation cells and the heatmap */
+static void _ResetPointBuffer(void)
+{
+    memset(&map_buf, 0, sizeof(map_buf));
+    map_point_idx = 0;
+    map_point_writes += POINT_BUF_SIZE;
+    map_reproject_remaining = 0;
+    map_accumulate_revolutions = 0;
+    map_accumulating = map_persistence_mode == MAP_PERSIST_ACCUMULATE && map_render_mode != MAP_RENDER_HEATMAP;
+    map_heat_drawn = 0;
+    map_heat_revolutions = 0;
+    map_heat_load_row = MAP_HEAT_COLS;
+}
+
+/* Voxel grid downsampling, the samples falling in the same cell are averaged */
+static void _AccumulatePoint(const point_t *point, uint8_t quality)
+{
+    uint16_t x = point->x - MAP_TOOLBAR_WIDTH;
+    uint16_t key = (point->y / MAP_CELL_SIZE) * MAP_CELL_COLS + x / MAP_CELL_SIZE;
+    uint16_t idx = ((uint32_t) key * MAP_CELL_HASH) % (sizeof(map_buf.cells) / sizeof(map_cell_t));
+
+    // Open addressing, the room outline fills a small part of the table
+    for (uint8_t probe = 0; probe < MAP_CELL_PROBES; probe++)
+    {
+        map_cell_t *cell = &map_cells[idx];
+        if (cell->hits == 0)
+        {
+            cell->key = key;
+        }
+        if (cell->key == key)
+        {
+            if (cell->hits < MAP_CELL_HITS_MAX)
+            {
+                cell->hits++;
+                cell->sum_dx += x % MAP_CELL_SIZE;
+                cell->sum_dy += point->y % MAP_CELL_SIZE;
+                cell->sum_quality += quality;
+            }
+            return;
+        }
+        idx = (idx + 1) % (sizeof(map_buf.cells) / sizeof(map_cell_t));
+    }
+    map_cells_dropped++;
+}
+
+/* Draw each cell once at its average position and quality, the cells become the points of the map */
+static void _RenderCells(void)
+{
+    uint16_t count = 0;
+
+    // Compacted in place: a point is smaller than a cell, so it never overwrites a cell not read yet
+    for (uint16_t i = 0; i < sizeof(map_buf.cells) / sizeof(map_cell_t); i++)
+    {
+        map_cell_t cell = map_cells[i];
+        if (cell.hits == 0)
+        {
+            continue;
+        }
+
+        point_t *point = &map_point_buf[count++];
+        point->x = MAP_TOOLBAR_WIDTH + (cell.key % MAP_CELL_COLS) * MAP_CELL_SIZE
+                + (cell.sum_dx * 2 + cell.hits) / (2 * cell.hits);
+        point->y = (cell.key / MAP_CELL_COLS) * MAP_CELL_SIZE + (cell.sum_dy * 2 + cell.hits) / (2 * cell.hits);
+        point->quality = (cell.sum_quality + cell.hits / 2) / cell.hits;
+        ILI9488_PixelRGB666(point->x, point->y, _GetQualityRGB666(point->quality));
+    }
+    memset(&map_point_buf[count], 0, sizeof(point_t) * (POINT_BUF_SIZE - count));
+
+    map_point_idx = count % POINT_BUF_SIZE;
+    map_point_writes += POINT_BUF_SIZE;
+    map_cells_updated = count;
+    map_accumulating = false;
+}
+
+/* Count the hit in its cell, the cell is redrawn only when its color changes */
+static void _AddHeat(const point_t *point)
 {
-    return sqrt(pow(p2->x - p1->x, 2) + pow(p2->y - p1->y, 2)) / map_scale_factor;
+    uint16_t col = (point->x - MAP_TOOLBAR_WIDTH) / MAP_HEAT_CELL_SIZE;
+    uint16_t row = point->y / MAP_HEAT_CELL_SIZE;
+
+    // Points on the right and bottom edges belong to the last cells
+    col = col < MAP_HEAT_COLS ? col : MAP_HEAT_COLS - 1;
+    row = row < MAP_HEAT_COLS ? row : MAP_HEAT_COLS - 1;
+
+    uint16_t idx = row * MAP_HEAT_COLS + col;
+    uint8_t hits = map_heat[idx];
+    if (hits == MAP_HEAT_HITS_MAX)
+    {
+        return;
+    }
+    map_heat[idx] = hits + 1;
+    if (_GetHeatLevel(hits + 1) != _GetHeatLevel(hits))
+    {
+        _DrawHeatCell(idx);
+    }
+}
+
+static void _EndHeatRevolution(void)
+{
+    map_cells_updated = map_heat_drawn;
+    map_heat_drawn = 0;
+
+    if (map_persistence_mode != MAP_PERSIST_OFF || ++map_heat_revolutions < MAP_HEAT_DECAY_REVOLUTIONS)
+    {
+        return;
+    }
+    map_heat_revolutions = 0;
+
+    // Halve the hits so that the heatmap follows the room, cells emptied also erase the grid under them
+    bool erased = false;
+    for (uint16_t idx = 0; idx < MAP_HEAT_COLS * MAP_HEAT_COLS; idx++)
+    {
+        uint8_t hits = map_heat[idx];
+        if (hits == 0)
+        {
+            continue;
+        }
+        map_heat[idx] = hits / 2;
+        if (_GetHeatLevel(hits / 2) != _GetHeatLevel(hits))
+        {
+            _DrawHeatCell(idx);
+            erased |= hits / 2 == 0;
+        }
+    }
+    if (erased)
+    {
+        _DrawGrid();
+    }
+}
+
+static void _DrawHeatmap(void)
+{
+    for (uint16_t idx = 0; idx < MAP_HEAT_COLS * MAP_HEAT_COLS; idx++)
+    {
+        if (map_heat[idx] > 0)
+        {
+            _DrawHeatCell(idx);
+        }
+    }
+}
+
+/* The tiles keep the hits of the whole session while tracking, the heatmap is refilled from them at its new scale */
+static void _LoadHeat(void)
+{
+    map_heat_load_row = map_tracking ? 0 : MAP_HEAT_COLS;
+}
+
+static void _LoadHeatRows(uint8_t count)
+{
+    uint8_t hits[MAP_HEAT_COLS];
+    double cell_mm = MAP_HEAT_CELL_SIZE / map_scale_factor;
+    // Fine tiles only cover the surroundings of the path, they are read when their cells are not much smaller
+    tile_level_e level = cell_mm < 2 * TILE_GetCellSize(TILE_LEVEL_FINE) ? TILE_LEVEL_FINE : TILE_LEVEL_COARSE;
+    // Centre of the first cell of the row, the rounded step drifts by less than half a fine cell along the row
+    int32_t x = lround((MAP_TOOLBAR_WIDTH + MAP_HEAT_CELL_SIZE / 2.0 - ILI9488_HEIGHT / 2) / map_scale_factor);
+
+    while (count-- > 0 && map_heat_load_row < MAP_HEAT_COLS)
+    {
+        uint16_t row = map_heat_load_row++;
+        int32_t y = lround((row * MAP_HEAT_CELL_SIZE + MAP_HEAT_CELL_SIZE / 2.0 - ILI9488_WIDTH / 2) / map_scale_factor);
+
+        TILE_GetRow(level, x, y, lround(cell_mm), MAP_HEAT_COLS, hits);
+        for (uint16_t col = 0; col < MAP_HEAT_COLS; col++)
+        {
+            // The tiles already count the hits added since the heatmap restarted
+            uint16_t idx = row * MAP_HEAT_COLS + col;
+            if (hits[col] > map_heat[idx])
+            {
+                bool redraw = _GetHeatLevel(hits[col]) != _GetHeatLevel(map_heat[idx]);
+                map_heat[idx] = hits[col];
+                if (redraw)
+                {
+                    _DrawHeatCell(idx);
+                }
+            }
+        }
+    }
+}
+
+static void _DrawHeatCell(uint16_t idx)
+{
+    ILI9488_FillAreaRGB666(MAP_TOOLBAR_WIDTH + (idx % MAP_HEAT_COLS) * MAP_HEAT_CELL_SIZE,
+                           (idx / MAP_HEAT_COLS) * MAP_HEAT_CELL_SIZE, MAP_HEAT_CELL_SIZE, MAP_HEAT_CELL_SIZE,
+                           &map_heat_colors[_GetHeatLevel(map_heat[idx])]);
+    map_heat_drawn++;
+}
+
+/* 0 for no hit, then one level per power of two */
+static uint8_t _GetHeatLevel(uint8_t hits)
+{
+    uint8_t level = 0;
+
+    if (hits > 0)
+    {
+        level = 1;
+        while (hits > 1 && level < MAP_HEAT_LEVELS - 1)
+        {
+            hits >>= 1;
+            level++;
+        }
+    }
+    return level;
 }
@@ -0,0 +1,297 @@
+/*
+ * match.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "match.h"
+
+#define MATCH_BINS 720 // Keyframe angle bins, 0.5° each
+#define MATCH_POINTS_MIN 30
+#define MATCH_DIST_START 300.0f // mm, correspondence gate of the first iteration
+#define MATCH_DIST_END 100.0f // mm, gate once converged
+#define MATCH_INLIER_RATIO_MIN 0.3f
+#define MATCH_CONVERGED_MM 1.0f
+#define MATCH_CONVERGED_RAD 0.001f
+#define MATCH_KEYFRAME_DIST 250.0f // mm
+#define MATCH_KEYFRAME_ANGLE 0.14f // rad, 8°
+#define MATCH_NONE INT16_MIN
+
+// Keyframe, one point per angle bin in the keyframe sensor frame
+static int16_t match_ref_x[MATCH_BINS];
+static int16_t match_ref_y[MATCH_BINS];
+static bool match_ref_valid = false;
+static match_pose_t match_ref_pose; // Keyframe in the map frame
+
+// Decimated points of the sweep being aligned
+static float match_cur_x[MATCH_POINTS_MAX];
+static float match_cur_y[MATCH_POINTS_MAX];
+static uint16_t match_cur_count = 0;
+
+static match_pose_t match_rel_pose; // Sweep in the keyframe frame
+static match_pose_t match_pose; // Sweep in the map frame
+static match_stats_t match_stats = {0};
+
+static void _LoadSweep(const sweep_frame_t *sweep);
+static void _SetKeyframe(const sweep_frame_t *sweep);
+static bool _Align(void);
+static int16_t _FindNearest(float x, float y, float dist_max);
+static bool _GetNormal(int16_t bin, float *nx, float *ny);
+static void _Compose(const match_pose_t *a, const match_pose_t *b, match_pose_t *result);
+
+void MATCH_Reset(void)
+{
+    match_ref_valid = false;
+    memset(&match_pose, 0, sizeof(match_pose));
+    memset(&match_rel_pose, 0, sizeof(match_rel_pose));
+    memset(&match_ref_pose, 0, sizeof(match_ref_pose));
+}
+
+bool MATCH_AddSweep(const sweep_frame_t *sweep)
+{
+    if (!match_ref_valid)
+    {
+        // First sweep defines the map frame
+        _SetKeyframe(sweep);
+        match_stats.keyframes++;
+        return true;
+    }
+
+    _LoadSweep(sweep);
+    if (!_Align())
+    {
+        match_stats.failed++;
+        return false;
+    }
+    match_stats.matched++;
+    _Compose(&match_ref_pose, &match_rel_pose, &match_pose);
+
+    if (hypotf(match_rel_pose.x, match_rel_pose.y) > MATCH_KEYFRAME_DIST
+            || fabsf(match_rel_pose.theta) > MATCH_KEYFRAME_ANGLE)
+    {
+        // Overlap with the keyframe decreases, start a new one from the aligned sweep
+        match_ref_pose = match_pose;
+        _SetKeyframe(sweep);
+        match_stats.keyframes++;
+    }
+
+    return true;
+}
+
+void MATCH_GetPose(match_pose_t *pose)
+{
+    *pose = match_pose;
+}
+
+void MATCH_GetStats(match_stats_t *stats)
+{
+    *stats = match_stats;
+}
+
+/* Keep an evenly spread subset of the sweep to bound the alignment time */
+static void _LoadSweep(const sweep_frame_t *sweep)
+{
+    uint16_t step = (sweep->count + MATCH_POINTS_MAX - 1) / MATCH_POINTS_MAX;
+
+    match_cur_count = 0;
+    for (uint16_t i = 0; i < sweep->count && match_cur_count < MATCH_POINTS_MAX; i += step ? step : 1)
+    {
+        float distance_mm = sweep->samples[i].distance / 4.0f;
+        float angle_rad = (sweep->samples[i].angle / 64.0f) * (float) M_PI / 180.0f;
+        match_cur_x[match_cur_count] = distance_mm * sinf(angle_rad);
+        match_cur_y[match_cur_count] = -distance_mm * cosf(angle_rad);
+        match_cur_count++;
+    }
+}
+
+static void _SetKeyframe(const sweep_frame_t *sweep)
+{
+    for (uint16_t bin = 0; bin < MATCH_BINS; bin++)
+    {
+        match_ref_x[bin] = MATCH_NONE;
+    }
+
+    for (uint16_t i = 0; i < sweep->count; i++)
+    {
+        uint16_t bin = ((uint32_t) sweep->samples[i].angle * MATCH_BINS) / (360 * 64);
+        if (bin >= MATCH_BINS)
+        {
+            continue;
+        }
+        float distance_mm = sweep->samples[i].distance / 4.0f;
+        float angle_rad = (sweep->samples[i].angle / 64.0f) * (float) M_PI / 180.0f;
+        match_ref_x[bin] = lroundf(distance_mm * sinf(angle_rad));
+        match_ref_y[bin] = lroundf(-distance_mm * cosf(angle_rad));
+    }
+
+    memset(&match_rel_pose, 0, sizeof(match_rel_pose));
+    match_ref_valid = true;
+}
+
+/* Point-to-line ICP from the previous relative pose, solved on (x, y, theta) by Gauss-Newton */
+static bool _Align(void)
+{
+    match_pose_t pose = match_rel_pose;
+    float dist_max = MATCH_DIST_START;
+    uint16_t inliers = 0;
+    uint16_t searches = 0;
+    uint8_t iteration;
+
+    if (match_cur_count < MATCH_POINTS_MIN)
+    {
+        return false;
+    }
+
+    for (iteration = 0; iteration < MATCH_ITERATIONS_MAX; iteration++)
+    {
+        float c = cosf(pose.theta);
+        float s = sinf(pose.theta);
+        float h[6] = {0}; // Upper triangle of the 3x3 normal matrix
+        float g[3] = {0};
+
+        inliers = 0;
+        searches += match_cur_count;
+        for (uint16_t i = 0; i < match_cur_count; i++)
+        {
+            float px = c * match_cur_x[i] - s * match_cur_y[i] + pose.x;
+            float py = s * match_cur_x[i] + c * match_cur_y[i] + pose.y;
+            float nx, ny;
+            int16_t bin = _FindNearest(px, py, dist_max);
+            if (bin < 0 || !_GetNormal(bin, &nx, &ny))
+            {
+                continue;
+            }
+
+            // Residual along the normal and its derivatives for a small motion around the keyframe origin
+            float r = (px - match_ref_x[bin]) * nx + (py - match_ref_y[bin]) * ny;
+            float j[3] = {nx, ny, -py * nx + px * ny};
+            h[0] += j[0] * j[0];
+            h[1] += j[0] * j[1];
+            h[2] += j[0] * j[2];
+            h[3] += j[1] * j[1];
+            h[4] += j[1] * j[2];
+            h[5] += j[2] * j[2];
+            g[0] += j[0] * r;
+            g[1] += j[1] * r;
+            g[2] += j[2] * r;
+            inliers++;
+        }
+
+        if (inliers < MATCH_POINTS_MIN)
+        {
+            break;
+        }
+
+        // Solve H.d = -g by Cramer's rule
+        float det = h[0] * (h[3] * h[5] - h[4] * h[4]) - h[1] * (h[1] * h[5] - h[4] * h[2])
+                + h[2] * (h[1] * h[4] - h[3] * h[2]);
+        if (fabsf(det) < 1e-6f)
+        {
+            // Degenerate geometry (single wall, corridor), the motion along it is unobservable
+            break;
+        }
+        float dx = -(g[0] * (h[3] * h[5] - h[4] * h[4]) - h[1] * (g[1] * h[5] - h[4] * g[2])
+                + h[2] * (g[1] * h[4] - h[3] * g[2])) / det;
+        float dy = -(h[0] * (g[1] * h[5] - g[2] * h[4]) - g[0] * (h[1] * h[5] - h[4] * h[2])
+                + h[2] * (h[1] * g[2] - g[1] * h[2])) / det;
+        float dt = -(h[0] * (h[3] * g[2] - h[4] * g[1]) - h[1] * (h[1] * g[2] - h[4] * g[0])
+                + g[0] * (h[1] * h[4] - h[3] * h[2])) / det;
+
+        // Apply the increment in the keyframe frame: rotate the current pose then translate it
+        float dc = cosf(dt);
+        float ds = sinf(dt);
+        float x = dc * pose.x - ds * pose.y + dx;
+        float y = ds * pose.x + dc * pose.y + dy;
+        pose.x = x;
+        pose.y = y;
+        pose.theta += dt;
+
+        if (fabsf(dx) < MATCH_CONVERGED_MM && fabsf(dy) < MATCH_CONVERGED_MM && fabsf(dt) < MATCH_CONVERGED_RAD)
+        {
+            if (dist_max <= MATCH_DIST_END)
+            {
+                iteration++;
+                break;
+            }
+            // Converged with the wide gate, refine with the narrow one to drop wrong correspondences
+            dist_max = MATCH_DIST_END;
+        }
+    }
+
+    match_stats.inliers = inliers;
+    match_stats.iterations = iteration;
+    match_stats.searches = searches;
+    if (inliers < MATCH_POINTS_MIN || inliers < match_cur_count * MATCH_INLIER_RATIO_MIN)
+    {
+        return false;
+    }
+    match_rel_pose = pose;
+    return true;
+}
+
+/* Nearest keyframe point among the bins around the point direction, -1 if none within the gate */
+static int16_t _FindNearest(float x, float y, float dist_max)
+{
+    float angle = atan2f(x, -y);
+    int16_t center = lroundf(angle * (MATCH_BINS / (2 * (float) M_PI)));
+    float dist2_min = dist_max * dist_max;
+    int16_t nearest = -1;
+
+    for (int16_t offset = -1; offset <= 1; offset++)
+    {
+        int16_t bin = (center + offset + MATCH_BINS) % MATCH_BINS;
+        if (match_ref_x[bin] == MATCH_NONE)
+        {
+            continue;
+        }
+        float dx = x - match_ref_x[bin];
+        float dy = y - match_ref_y[bin];
+        if (dx * dx + dy * dy < dist2_min)
+        {
+            dist2_min = dx * dx + dy * dy;
+            nearest = bin;
+        }
+    }
+    return nearest;
+}
+
+/* Normal of the keyframe surface at a bin, from its neighbours */
+static bool _GetNormal(int16_t bin, float *nx, float *ny)
+{
+    int16_t prev = (bin + MATCH_BINS - 1) % MATCH_BINS;
+    int16_t next = (bin + 1) % MATCH_BINS;
+
+    if (match_ref_x[prev] == MATCH_NONE)
+    {
+        prev = bin;
+    }
+    if (match_ref_x[next] == MATCH_NONE)
+    {
+        next = bin;
+    }
+    float tx = match_ref_x[next] - match_ref_x[prev];
+    float ty = match_ref_y[next] - match_ref_y[prev];
+    float length = sqrtf(tx * tx + ty * ty);
+    if (length < 1.0f || length > MATCH_DIST_START)
+    {
+        // Isolated point or depth discontinuity, the surface direction is unknown
+        return false;
+    }
+    *nx = -ty / length;
+    *ny = tx / length;
+    return true;
+}
+
+static void _Compose(const match_pose_t *a, const match_pose_t *b, match_pose_t *result)
+{
+    float c = cosf(a->theta);
+    float s = sinf(a->theta);
+    result->x = a->x + c * b->x - s * b->y;
+    result->y = a->y + s * b->x + c * b->y;
+    result->theta = a->theta + b->theta;
+}
@@ -15,6 +15,7 @@
 #include "map.h"
 #include "diag.h"
 #include "buzzer.h"
+#include "profile.h"
 
 #define MENU_BUTTON_DEBOUNCE_TIMER 100 // ms
 
@@ -58,8 +59,16 @@ void MENU_HandleTouch(void)
     uint16_t x = 0;
     uint16_t y = 0;
 
-    if (XPT2046_GotATouch() && XPT2046_GetTouchPosition(&x, &y))
+    if (XPT2046_GotATouch())
     {
+        PROFILE_BEGIN(PROFILE_ZONE_TOUCH_POLL);
+        bool is_touched = XPT2046_GetTouchPosition(&x, &y);
+        PROFILE_END(PROFILE_ZONE_TOUCH_POLL);
+        if (!is_touched)
+        {
+            return;
+        }
+
         switch (menu_screen)
         {
             case MENU_SCREEN_MAIN:
@@ -100,6 +109,7 @@ void MENU_UpdateScreen(void)
                 DIAG_Show();
                 menu_screen_initialized = true;
             }
+            DIAG_Update();
             break;
     }
 }
@@ -107,7 +117,7 @@ void MENU_UpdateScreen(void)
 static void _MainShow(void)
 {
     ILI9488_FillScreen(BLACK);
-    ILI9488_DrawImage(100, ILI9488_WIDTH / 2 - 62, 64, 64, logo, sizeof(logo));
+    ILI9488_DrawCompressedImage(100, ILI9488_WIDTH / 2 - 62, &logo);
     ILI9488_WString(180, ILI9488_WIDTH / 2 - 42, "ROOM MAPPER", Font24, 1, WHITE, BLACK);
     ILI9488_DrawBorder(80, ILI9488_WIDTH / 2 - 80, 320, 100, 2, WHITE);
     ILI9488_CString(0, 220, ILI9488_HEIGHT, 250, "Press to START", Font20, 1, GREEN, BLACK);
@@ -132,7 +142,7 @@ static void _MainShow(void)
     ILI9488_DrawCircle(ILI9488_HEIGHT - 25,
                        ((ILI9488_WIDTH - MENU_VOLUME_BAR_HEIGHT) / 2) + MENU_VOLUME_BAR_HEIGHT + 25, 15, WHITE);
 
-    ILI9488_DrawImage(ILI9488_HEIGHT - 34, ILI9488_WIDTH - 30, 24, 24, volume, sizeof(volume));
+    ILI9488_DrawCompressedImage(ILI9488_HEIGHT - 34, ILI9488_WIDTH - 30, &volume);
 }
 
 static void _MainDrawVolumeBar(void)
@@ -0,0 +1,170 @@
+/*
+ * motor.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f4xx_hal.h"
+#include "motor.h"
+#include "rplidar.h"
+
+#define MOTOR_RPM_MIN 300
+#define MOTOR_RPM_MAX 1200
+#define MOTOR_CMD_MIN (MOTOR_RPM_MIN / 2)
+#define MOTOR_CMD_MAX (MOTOR_RPM_MAX * 3 / 2)
+#define MOTOR_DEADBAND_RPM 5
+#define MOTOR_UPDATE_PERIOD 500 // ms
+#define MOTOR_MIN_REVOLUTIONS 2 // Revolutions needed between two corrections
+#define MOTOR_DEFAULT_US_PER_SAMPLE (500 << 8) // Q8, legacy scan sample duration when no mode is discovered
+
+static const uint16_t motor_profile_rpm[MOTOR_PROFILE_MAX] = {
+        [MOTOR_PROFILE_DENSE] = 360,
+        [MOTOR_PROFILE_BALANCED] = 600,
+        [MOTOR_PROFILE_FAST] = 900};
+
+static bool motor_enabled = false;
+static motor_profile_e motor_profile = MOTOR_PROFILE_BALANCED;
+static uint16_t motor_target_rpm = 600;
+static int32_t motor_cmd_rpm = 600;
+static uint16_t motor_measured_rpm = 0;
+static uint32_t motor_update_tick = 0;
+static uint32_t motor_revolutions = 0;
+static uint32_t motor_revolution_tick = 0;
+static bool motor_window_started = false; // The window starts at the first revolution after enabling
+static bool motor_cmd_pending = false; // Command refused by the UART, sent again on the next update
+
+static uint32_t _GetUsPerSample(void);
+static uint16_t _ClampRpm(int32_t rpm, int32_t min, int32_t max);
+
+void MOTOR_Enable(bool enable)
+{
+    rplidar_stats_t stats;
+
+    motor_enabled = enable;
+    motor_measured_rpm = 0;
+    if (enable)
+    {
+        // Start from the target, the last revolution seen belongs to the previous scan
+        RPLIDAR_GetStats(&stats);
+        motor_revolutions = stats.revolutions;
+        motor_window_started = false;
+        motor_update_tick = HAL_GetTick();
+        motor_cmd_rpm = motor_target_rpm;
+        motor_cmd_pending = !RPLIDAR_SetMotorSpeed(motor_cmd_rpm);
+    }
+}
+
+void MOTOR_Update(void)
+{
+    rplidar_stats_t stats;
+    uint32_t tick_cur = HAL_GetTick();
+
+    if (!motor_enabled || tick_cur - motor_update_tick < MOTOR_UPDATE_PERIOD)
+    {
+        return;
+    }
+    motor_update_tick = tick_cur;
+
+    if (motor_cmd_pending)
+    {
+        motor_cmd_pending = !RPLIDAR_SetMotorSpeed(motor_cmd_rpm);
+    }
+
+    RPLIDAR_GetStats(&stats);
+    if (!motor_window_started)
+    {
+        // A window starting before the scan would span the idle gap and measure a far too low rate
+        if (stats.revolutions != motor_revolutions)
+        {
+            motor_revolutions = stats.revolutions;
+            motor_revolution_tick = stats.revolution_tick;
+            motor_window_started = true;
+        }
+        return;
+    }
+
+    uint32_t revolutions = stats.revolutions - motor_revolutions;
+    uint32_t elapsed = stats.revolution_tick - motor_revolution_tick;
+    if (revolutions < MOTOR_MIN_REVOLUTIONS || elapsed == 0)
+    {
+        // Not enough revolutions to measure the rate, wait for more
+        return;
+    }
+    motor_revolutions = stats.revolutions;
+    motor_revolution_tick = stats.revolution_tick;
+
+    // Time between the first and last start flags of the window
+    motor_measured_rpm = (revolutions * 60000) / elapsed;
+
+    int32_t error = (int32_t) motor_target_rpm - motor_measured_rpm;
+    if (error > MOTOR_DEADBAND_RPM || error < -MOTOR_DEADBAND_RPM)
+    {
+        // Integral correction, half of the error per update to avoid overshoot
+        motor_cmd_rpm = _ClampRpm(motor_cmd_rpm + error / 2, MOTOR_CMD_MIN, MOTOR_CMD_MAX);
+        motor_cmd_pending = !RPLIDAR_SetMotorSpeed(motor_cmd_rpm);
+    }
+}
+
+void MOTOR_SetProfile(motor_profile_e profile)
+{
+    if (profile >= MOTOR_PROFILE_MAX)
+    {
+        return;
+    }
+    motor_profile = profile;
+    MOTOR_SetTargetRpm(motor_profile_rpm[profile]);
+}
+
+motor_profile_e MOTOR_GetProfile(void)
+{
+    return motor_profile;
+}
+
+void MOTOR_SetTargetRpm(uint16_t rpm)
+{
+    motor_target_rpm = _ClampRpm(rpm, MOTOR_RPM_MIN, MOTOR_RPM_MAX);
+}
+
+uint16_t MOTOR_GetTargetRpm(void)
+{
+    return motor_target_rpm;
+}
+
+void MOTOR_SetAngularResolution(uint16_t resolution_mdeg)
+{
+    // resolution (mdeg) = 360000 * (rpm / 60) * us_per_sample / 1000000
+    uint64_t rpm = ((uint64_t) resolution_mdeg * 1000 * 256) / (6 * (uint64_t) _GetUsPerSample());
+    MOTOR_SetTargetRpm(rpm > UINT16_MAX ? UINT16_MAX : rpm);
+}
+
+uint16_t MOTOR_GetAngularResolution(void)
+{
+    return ((uint64_t) motor_measured_rpm * 6 * _GetUsPerSample()) / (1000 * 256);
+}
+
+uint16_t MOTOR_GetMeasuredRpm(void)
+{
+    return motor_measured_rpm;
+}
+
+static uint32_t _GetUsPerSample(void)
+{
+    const rplidar_scan_mode_t *mode = RPLIDAR_GetSelectedScanMode();
+    return (mode != NULL && mode->us_per_sample != 0) ? mode->us_per_sample : MOTOR_DEFAULT_US_PER_SAMPLE;
+}
+
+static uint16_t _ClampRpm(int32_t rpm, int32_t min, int32_t max)
+{
+    if (rpm < min)
+    {
+        return min;
+    }
+    else if (rpm > max)
+    {
+        return max;
+    }
+    return rpm;
+}
@@ -0,0 +1,131 @@
+/*
+ * profile.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f4xx_hal.h"
+#include "profile.h"
+
+#if PROFILE_ENABLED
+
+#define PROFILE_LOAD_WINDOW_MS 500
+
+static volatile profile_stats_t profile_stats[PROFILE_ZONE_MAX];
+static uint32_t profile_loop_last = 0;
+static uint32_t profile_loop_min = UINT32_MAX;
+static uint32_t profile_loop_window_start = 0;
+static uint32_t profile_loop_window_iter = 0;
+static uint8_t profile_cpu_load = 0;
+
+static const char *const profile_zone_names[PROFILE_ZONE_MAX] = {
+        [PROFILE_ZONE_UART_ISR] = "UART ISR",
+        [PROFILE_ZONE_PARSE_RX] = "PARSE RX",
+        [PROFILE_ZONE_CONVERT_SAMPLE] = "CONVERT",
+        [PROFILE_ZONE_FILL_AREA] = "FILL AREA",
+        [PROFILE_ZONE_TOUCH_POLL] = "TOUCH"};
+
+static void _ResetZone(profile_zone_e zone);
+
+void PROFILE_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint8_t i = 0; i < PROFILE_ZONE_MAX; i++)
+    {
+        _ResetZone(i);
+    }
+    profile_loop_last = DWT->CYCCNT;
+    profile_loop_window_start = profile_loop_last;
+}
+
+void PROFILE_Record(profile_zone_e zone, uint32_t cycles)
+{
+    volatile profile_stats_t *stats = &profile_stats[zone];
+
+    // Zones can be recorded from interrupts, prevent preemption while updating
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (cycles < stats->min)
+    {
+        stats->min = cycles;
+    }
+    if (cycles > stats->max)
+    {
+        stats->max = cycles;
+    }
+    stats->total += cycles;
+    stats->count++;
+    __set_PRIMASK(primask);
+}
+
+void PROFILE_LoopTick(void)
+{
+    uint32_t now = DWT->CYCCNT;
+    uint32_t iteration = now - profile_loop_last;
+    uint32_t window = now - profile_loop_window_start;
+    profile_loop_last = now;
+
+    if (iteration < profile_loop_min)
+    {
+        // Shortest iteration is the cost of an idle loop
+        profile_loop_min = iteration;
+    }
+    profile_loop_window_iter++;
+
+    if (window >= (SystemCoreClock / 1000) * PROFILE_LOAD_WINDOW_MS)
+    {
+        uint64_t idle = (uint64_t) profile_loop_window_iter * profile_loop_min;
+        profile_cpu_load = idle >= window ? 0 : (uint8_t) (100 - (idle * 100) / window);
+        profile_loop_window_start = now;
+        profile_loop_window_iter = 0;
+    }
+}
+
+void PROFILE_GetStats(profile_zone_e zone, profile_stats_t *stats, bool reset)
+{
+    if (zone >= PROFILE_ZONE_MAX || stats == NULL)
+    {
+        return;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    memcpy(stats, (const void*) &profile_stats[zone], sizeof(profile_stats_t));
+    if (reset)
+    {
+        _ResetZone(zone);
+    }
+    __set_PRIMASK(primask);
+
+    if (stats->count == 0)
+    {
+        stats->min = 0;
+    }
+}
+
+uint8_t PROFILE_GetCpuLoad(void)
+{
+    return profile_cpu_load;
+}
+
+const char* PROFILE_GetZoneName(profile_zone_e zone)
+{
+    return zone < PROFILE_ZONE_MAX ? profile_zone_names[zone] : "";
+}
+
+static void _ResetZone(profile_zone_e zone)
+{
+    profile_stats[zone].min = UINT32_MAX;
+    profile_stats[zone].max = 0;
+    profile_stats[zone].total = 0;
+    profile_stats[zone].count = 0;
+}
+
+#endif /* PROFILE_ENABLED */
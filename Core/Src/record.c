@@ -0,0 +1,192 @@
+/*
+ * record.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f4xx_hal.h"
+#include "record.h"
+#include "store.h"
+#include "link.h"
+
+#define RECORD_ID_HEADER 0
+#define RECORD_ID_DATA 1 // The ring wraps at most once, so the entries are saved in one or two records
+#define RECORD_PARTS 3
+
+static uint8_t record_buf[RECORD_BUFFER_SIZE];
+static uint16_t record_head = 0; // Next byte written
+static uint16_t record_tail = 0; // First byte of the oldest entry
+static uint16_t record_used = 0;
+static uint16_t record_entries = 0;
+static uint32_t record_last_timestamp = 0; // Reception time of the newest entry
+static uint32_t record_overwritten = 0;
+static uint32_t record_dumps = 0;
+static volatile bool record_frozen = false;
+static uint8_t record_send_part = RECORD_PARTS; // Next part sent, RECORD_PARTS when idle
+
+static void _Put(const uint8_t *data, uint16_t length);
+static uint16_t _GetLength(uint16_t idx);
+static uint32_t _GetTimestamp(uint16_t idx);
+static void _Clear(void);
+
+void RECORD_AddData(const uint8_t *data, uint16_t length)
+{
+    uint32_t timestamp = DWT->CYCCNT;
+    uint8_t header[RECORD_ENTRY_HEADER_SIZE];
+
+    if (record_frozen || length == 0)
+    {
+        return;
+    }
+
+    if (length > RECORD_BUFFER_SIZE - RECORD_ENTRY_HEADER_SIZE)
+    {
+        // Only the end fits
+        data += length - (RECORD_BUFFER_SIZE - RECORD_ENTRY_HEADER_SIZE);
+        length = RECORD_BUFFER_SIZE - RECORD_ENTRY_HEADER_SIZE;
+    }
+
+    while (RECORD_BUFFER_SIZE - record_used < RECORD_ENTRY_HEADER_SIZE + length)
+    {
+        uint16_t size = RECORD_ENTRY_HEADER_SIZE + _GetLength(record_tail);
+        record_tail = (record_tail + size) % RECORD_BUFFER_SIZE;
+        record_used -= size;
+        record_entries--;
+        record_overwritten++;
+    }
+
+    memcpy(&header[0], &timestamp, sizeof(timestamp));
+    memcpy(&header[4], &length, sizeof(length));
+    _Put(header, RECORD_ENTRY_HEADER_SIZE);
+    _Put(data, length);
+    record_used += RECORD_ENTRY_HEADER_SIZE + length;
+    record_entries++;
+    record_last_timestamp = timestamp;
+}
+
+bool RECORD_Dump(void)
+{
+    record_header_t header;
+
+    // Nothing is added from the interrupt until the ring is cleared
+    record_frozen = true;
+    record_send_part = RECORD_PARTS;
+
+    header.magic = RECORD_MAGIC;
+    header.version = RECORD_VERSION;
+    header.entries = record_entries;
+    header.length = record_used;
+    header.cycles_per_second = SystemCoreClock;
+    header.overwritten = record_overwritten;
+
+    // The ring is written as is, the part after the wrap goes in a second record
+    uint16_t first = record_used < RECORD_BUFFER_SIZE - record_tail ? record_used : RECORD_BUFFER_SIZE - record_tail;
+    uint16_t second = record_used - first;
+
+    bool success = STORE_Delete(STORE_TYPE_RECORD, STORE_ID_ALL)
+            && STORE_Reserve(sizeof(header) + record_used, RECORD_PARTS);
+    if (success && first > 0)
+    {
+        success = STORE_Write(STORE_TYPE_RECORD, RECORD_ID_DATA, &record_buf[record_tail], first);
+    }
+    if (success && second > 0)
+    {
+        success = STORE_Write(STORE_TYPE_RECORD, RECORD_ID_DATA + 1, &record_buf[0], second);
+    }
+    // Header last, a dump without header is ignored
+    if (success)
+    {
+        success = STORE_Write(STORE_TYPE_RECORD, RECORD_ID_HEADER, &header, sizeof(header));
+    }
+    if (success)
+    {
+        record_dumps++;
+    }
+
+    _Clear();
+    record_frozen = false;
+    return success;
+}
+
+bool RECORD_Send(void)
+{
+    uint16_t length;
+
+    if (record_send_part < RECORD_PARTS || STORE_Find(STORE_TYPE_RECORD, RECORD_ID_HEADER, &length) == NULL)
+    {
+        return false;
+    }
+    record_send_part = 0;
+    return true;
+}
+
+void RECORD_Update(void)
+{
+    uint16_t length = 0;
+
+    if (record_send_part >= RECORD_PARTS || LINK_IsBusy())
+    {
+        return;
+    }
+
+    // Header then data, the records are read in the memory mapped flash
+    const void *part = STORE_Find(STORE_TYPE_RECORD, record_send_part, &length);
+    if (part != NULL && !LINK_Transmit(part, length))
+    {
+        // No host connected
+        record_send_part = RECORD_PARTS;
+        return;
+    }
+    record_send_part++;
+}
+
+void RECORD_GetStats(record_stats_t *stats)
+{
+    stats->entries = record_entries;
+    stats->used = record_used;
+    stats->span = record_entries > 0 ? record_last_timestamp - _GetTimestamp(record_tail) : 0;
+    stats->overwritten = record_overwritten;
+    stats->dumps = record_dumps;
+}
+
+static void _Put(const uint8_t *data, uint16_t length)
+{
+    uint16_t first = length < RECORD_BUFFER_SIZE - record_head ? length : RECORD_BUFFER_SIZE - record_head;
+
+    memcpy(&record_buf[record_head], data, first);
+    memcpy(&record_buf[0], &data[first], length - first);
+    record_head = (record_head + length) % RECORD_BUFFER_SIZE;
+}
+
+static uint16_t _GetLength(uint16_t idx)
+{
+    // Entry header may wrap around the end of the ring
+    uint8_t low = record_buf[(idx + 4) % RECORD_BUFFER_SIZE];
+    uint8_t high = record_buf[(idx + 5) % RECORD_BUFFER_SIZE];
+    return low | (high << 8);
+}
+
+static uint32_t _GetTimestamp(uint16_t idx)
+{
+    uint32_t timestamp = 0;
+
+    // Entry header may wrap around the end of the ring
+    for (uint8_t i = 0; i < sizeof(timestamp); i++)
+    {
+        timestamp |= (uint32_t) record_buf[(idx + i) % RECORD_BUFFER_SIZE] << (8 * i);
+    }
+    return timestamp;
+}
+
+static void _Clear(void)
+{
+    record_head = 0;
+    record_tail = 0;
+    record_used = 0;
+    record_entries = 0;
+    record_overwritten = 0;
+}
@@ -0,0 +1,374 @@
+/*
+ * room.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "stm32f4xx_hal.h"
+#include "room.h"
+
+#define ROOM_BINS 720 // Accumulation bins, 0.5° each
+#define ROOM_POINTS_MIN 100 // Accumulated samples needed to start an estimate
+#define ROOM_HYPOTHESES 200 // RANSAC hypotheses per wall
+#define ROOM_INLIER_MM 30.0f // Maximum distance of a sample to its wall
+#define ROOM_INLIERS_MIN 30 // Samples needed to accept a wall
+#define ROOM_PAIR_MIN_MM 300.0f // Minimum distance between the two samples of a hypothesis
+#define ROOM_CORNER_SIN_MIN 0.34f // sin(20°), walls closer to parallel are joined without intersecting
+
+typedef enum
+{
+    ROOM_STATE_IDLE, ROOM_STATE_SEARCH, ROOM_STATE_POLYGON
+} room_state_e;
+
+typedef struct
+{
+    float x;
+    float y;
+} room_point_t;
+
+typedef struct
+{
+    float ux; // Direction, oriented counterclockwise around the sensor
+    float uy;
+    float cx; // Centroid of the inliers
+    float cy;
+    float t_min; // Extent of the inliers along the direction
+    float t_max;
+    float angle; // Polar angle of the centroid, used to order the walls
+} room_line_t;
+
+// Latest sample of each angle, int16 mm coordinates to keep the accumulation small
+static int16_t room_bin_x[ROOM_BINS];
+static int16_t room_bin_y[ROOM_BINS];
+static uint8_t room_bin_valid[ROOM_BINS / 8];
+static uint16_t room_bin_count = 0;
+
+// Snapshot of the bins the running estimate works on
+static room_point_t room_points[ROOM_BINS];
+static uint8_t room_used[ROOM_BINS];
+static uint16_t room_point_count = 0;
+
+static room_state_e room_state = ROOM_STATE_IDLE;
+static room_line_t room_lines[ROOM_WALLS_MAX];
+static uint8_t room_line_count = 0;
+static uint16_t room_hypothesis = 0;
+static uint16_t room_best_inliers = 0;
+static float room_best_nx, room_best_ny, room_best_c;
+static uint32_t room_random = 0x12345678;
+
+static room_t room_estimate;
+static bool room_estimate_valid = false;
+
+static void _StartEstimate(void);
+static void _TestHypothesis(void);
+static void _AcceptWall(void);
+static bool _BuildPolygon(void);
+static uint32_t _Random(void);
+
+void ROOM_Reset(void)
+{
+    memset(room_bin_valid, 0, sizeof(room_bin_valid));
+    room_bin_count = 0;
+    room_state = ROOM_STATE_IDLE;
+    room_estimate_valid = false;
+}
+
+void ROOM_AddSweep(const sweep_frame_t *sweep)
+{
+    for (uint16_t i = 0; i < sweep->count; i++)
+    {
+        const sweep_sample_t *sample = &sweep->samples[i];
+        uint16_t bin = ((uint32_t) sample->angle * ROOM_BINS) / (360 * 64);
+        if (bin >= ROOM_BINS)
+        {
+            continue;
+        }
+
+        float distance_mm = sample->distance / 4.0f;
+        float angle_rad = (sample->angle / 64.0f) * (float) M_PI / 180.0f;
+        room_bin_x[bin] = distance_mm * sinf(angle_rad);
+        room_bin_y[bin] = -distance_mm * cosf(angle_rad);
+        if (!(room_bin_valid[bin / 8] & (1 << (bin % 8))))
+        {
+            room_bin_valid[bin / 8] |= 1 << (bin % 8);
+            room_bin_count++;
+        }
+    }
+}
+
+bool ROOM_Update(uint32_t budget_us)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t budget = budget_us * (SystemCoreClock / 1000000);
+
+    do
+    {
+        switch (room_state)
+        {
+            default:
+            case ROOM_STATE_IDLE:
+                if (room_bin_count < ROOM_POINTS_MIN)
+                {
+                    return false;
+                }
+                _StartEstimate();
+                break;
+            case ROOM_STATE_SEARCH:
+                _TestHypothesis();
+                if (++room_hypothesis >= ROOM_HYPOTHESES)
+                {
+                    _AcceptWall();
+                }
+                break;
+            case ROOM_STATE_POLYGON:
+                room_state = ROOM_STATE_IDLE;
+                return _BuildPolygon();
+        }
+    } while (DWT->CYCCNT - start < budget);
+
+    return false;
+}
+
+const room_t* ROOM_Get(void)
+{
+    return room_estimate_valid ? &room_estimate : NULL;
+}
+
+/* Work on a copy of the accumulated samples, new sweeps keep being accumulated meanwhile */
+static void _StartEstimate(void)
+{
+    room_point_count = 0;
+    for (uint16_t bin = 0; bin < ROOM_BINS; bin++)
+    {
+        if (room_bin_valid[bin / 8] & (1 << (bin % 8)))
+        {
+            room_points[room_point_count].x = room_bin_x[bin];
+            room_points[room_point_count].y = room_bin_y[bin];
+            room_used[room_point_count] = false;
+            room_point_count++;
+        }
+    }
+    room_line_count = 0;
+    room_hypothesis = 0;
+    room_best_inliers = 0;
+    room_state = ROOM_STATE_SEARCH;
+}
+
+/* Count the unused samples close to the line through two random unused samples */
+static void _TestHypothesis(void)
+{
+    uint16_t i1 = _Random() % room_point_count;
+    uint16_t i2 = _Random() % room_point_count;
+    if (room_used[i1] || room_used[i2])
+    {
+        return;
+    }
+
+    float dx = room_points[i2].x - room_points[i1].x;
+    float dy = room_points[i2].y - room_points[i1].y;
+    float length = sqrtf(dx * dx + dy * dy);
+    if (length < ROOM_PAIR_MIN_MM)
+    {
+        return;
+    }
+
+    float nx = -dy / length;
+    float ny = dx / length;
+    float c = nx * room_points[i1].x + ny * room_points[i1].y;
+    uint16_t inliers = 0;
+    for (uint16_t i = 0; i < room_point_count; i++)
+    {
+        if (!room_used[i] && fabsf(nx * room_points[i].x + ny * room_points[i].y - c) < ROOM_INLIER_MM)
+        {
+            inliers++;
+        }
+    }
+
+    if (inliers > room_best_inliers)
+    {
+        room_best_inliers = inliers;
+        room_best_nx = nx;
+        room_best_ny = ny;
+        room_best_c = c;
+    }
+}
+
+/* Refine the best hypothesis on its inliers, then search for the next wall */
+static void _AcceptWall(void)
+{
+    if (room_best_inliers < ROOM_INLIERS_MIN)
+    {
+        // No more dominant wall
+        room_state = ROOM_STATE_POLYGON;
+        return;
+    }
+
+    room_line_t *line = &room_lines[room_line_count];
+    float sx = 0, sy = 0, sxx = 0, syy = 0, sxy = 0;
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < room_point_count; i++)
+    {
+        if (!room_used[i]
+                && fabsf(room_best_nx * room_points[i].x + room_best_ny * room_points[i].y - room_best_c)
+                        < ROOM_INLIER_MM)
+        {
+            sx += room_points[i].x;
+            sy += room_points[i].y;
+            count++;
+        }
+    }
+    line->cx = sx / count;
+    line->cy = sy / count;
+
+    for (uint16_t i = 0; i < room_point_count; i++)
+    {
+        if (!room_used[i]
+                && fabsf(room_best_nx * room_points[i].x + room_best_ny * room_points[i].y - room_best_c)
+                        < ROOM_INLIER_MM)
+        {
+            float dx = room_points[i].x - line->cx;
+            float dy = room_points[i].y - line->cy;
+            sxx += dx * dx;
+            syy += dy * dy;
+            sxy += dx * dy;
+        }
+    }
+
+    // Least squares direction, oriented so that moving along the wall turns counterclockwise
+    float theta = 0.5f * atan2f(2 * sxy, sxx - syy);
+    line->ux = cosf(theta);
+    line->uy = sinf(theta);
+    if (line->cx * line->uy - line->cy * line->ux < 0)
+    {
+        line->ux = -line->ux;
+        line->uy = -line->uy;
+    }
+    line->angle = atan2f(line->cy, line->cx);
+
+    line->t_min = INFINITY;
+    line->t_max = -INFINITY;
+    for (uint16_t i = 0; i < room_point_count; i++)
+    {
+        if (!room_used[i]
+                && fabsf(room_best_nx * room_points[i].x + room_best_ny * room_points[i].y - room_best_c)
+                        < ROOM_INLIER_MM)
+        {
+            float t = (room_points[i].x - line->cx) * line->ux + (room_points[i].y - line->cy) * line->uy;
+            line->t_min = fminf(line->t_min, t);
+            line->t_max = fmaxf(line->t_max, t);
+            room_used[i] = true;
+        }
+    }
+
+    room_line_count++;
+    room_hypothesis = 0;
+    room_best_inliers = 0;
+    if (room_line_count >= ROOM_WALLS_MAX)
+    {
+        room_state = ROOM_STATE_POLYGON;
+    }
+}
+
+/* Order the walls around the sensor and join consecutive walls at their intersection */
+static bool _BuildPolygon(void)
+{
+    room_point_t corners[ROOM_WALLS_MAX];
+    uint8_t count = room_line_count;
+
+    if (count < 3)
+    {
+        // Not enough walls to close a room, keep the previous estimate
+        return false;
+    }
+
+    // Insertion sort by polar angle
+    for (uint8_t i = 1; i < count; i++)
+    {
+        room_line_t line = room_lines[i];
+        int8_t j = i - 1;
+        while (j >= 0 && room_lines[j].angle > line.angle)
+        {
+            room_lines[j + 1] = room_lines[j];
+            j--;
+        }
+        room_lines[j + 1] = line;
+    }
+
+    // Corner i joins wall i - 1 to wall i
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const room_line_t *a = &room_lines[(i + count - 1) % count];
+        const room_line_t *b = &room_lines[i];
+        float cross = a->ux * b->uy - a->uy * b->ux;
+        if (fabsf(cross) >= ROOM_CORNER_SIN_MIN)
+        {
+            float t = ((b->cx - a->cx) * b->uy - (b->cy - a->cy) * b->ux) / cross;
+            corners[i].x = a->cx + t * a->ux;
+            corners[i].y = a->cy + t * a->uy;
+        }
+        else
+        {
+            // Parallel walls (recess or wall cut by a door), join the end of one to the start of the other
+            corners[i].x = (a->cx + a->t_max * a->ux + b->cx + b->t_min * b->ux) / 2;
+            corners[i].y = (a->cy + a->t_max * a->uy + b->cy + b->t_min * b->uy) / 2;
+        }
+    }
+
+    float area = 0;
+    float longest = 0;
+    uint8_t longest_idx = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        room_wall_t *wall = &room_estimate.walls[i];
+        const room_point_t *p1 = &corners[i];
+        const room_point_t *p2 = &corners[(i + 1) % count];
+        float length = sqrtf((p2->x - p1->x) * (p2->x - p1->x) + (p2->y - p1->y) * (p2->y - p1->y));
+
+        wall->x1 = lroundf(p1->x);
+        wall->y1 = lroundf(p1->y);
+        wall->x2 = lroundf(p2->x);
+        wall->y2 = lroundf(p2->y);
+        wall->length = length > UINT16_MAX ? UINT16_MAX : lroundf(length);
+        area += p1->x * p2->y - p2->x * p1->y; // Shoelace formula
+        if (length > longest)
+        {
+            longest = length;
+            longest_idx = i;
+        }
+    }
+
+    // Width and depth are the extents of the polygon along and across the longest wall
+    const room_line_t *ref = &room_lines[longest_idx];
+    float u_min = INFINITY, u_max = -INFINITY, v_min = INFINITY, v_max = -INFINITY;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        float u = corners[i].x * ref->ux + corners[i].y * ref->uy;
+        float v = corners[i].y * ref->ux - corners[i].x * ref->uy;
+        u_min = fminf(u_min, u);
+        u_max = fmaxf(u_max, u);
+        v_min = fminf(v_min, v);
+        v_max = fmaxf(v_max, v);
+    }
+
+    room_estimate.index++;
+    room_estimate.wall_count = count;
+    room_estimate.width = fminf(u_max - u_min, UINT16_MAX);
+    room_estimate.depth = fminf(v_max - v_min, UINT16_MAX);
+    room_estimate.area = fabsf(area) / 2 / 100; // mm² to cm²
+    room_estimate_valid = true;
+    return true;
+}
+
+/* Xorshift, enough to draw the RANSAC samples */
+static uint32_t _Random(void)
+{
+    room_random ^= room_random << 13;
+    room_random ^= room_random >> 17;
+    room_random ^= room_random << 5;
+    return room_random;
+}
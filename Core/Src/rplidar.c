@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include "stm32f4xx_hal.h"
 #include "rplidar.h"
+#include "profile.h"
 
 #define START_FLAG 0xA5
 
@@ -39,6 +40,23 @@
 
 #define REQ_CONF_PAYLOAD_MAX 16
 
+#define CONF_SCAN_MODE_COUNT 0x70
+#define CONF_SCAN_MODE_US_PER_SAMPLE 0x71
+#define CONF_SCAN_MODE_MAX_DISTANCE 0x74
+#define CONF_SCAN_MODE_ANS_TYPE 0x75
+#define CONF_SCAN_MODE_TYPICAL 0x7C
+#define CONF_SCAN_MODE_NAME 0x7F
+
+#define SCAN_MODE_STANDARD 0
+
+#define DENSE_SAMPLES_NB 40
+#define DENSE_QUALITY 47 // Dense answers have no quality, use the same default as the official SDK
+#define ANGLE_Q6_FULL_TURN (360 * 64)
+#define CAPSULE_SYNC1 0xA
+#define CAPSULE_SYNC2 0x5
+#define CAPSULE_HEADER_SIZE 2 // Sync and checksum bytes, not part of the checksum
+#define SCAN_MODE_REQUEST_TIMEOUT 100 // ms
+
 typedef enum parser_state
 {
     PARSER_DESCRIPTOR, PARSER_RESPONSE_SINGLE, PARSER_RESPONSE_MULTI, PARSER_ERROR
@@ -58,14 +76,22 @@ typedef enum response_type
 static UART_HandleTypeDef *rpl_uart;
 static uint8_t rpl_rx_buf[BUFFER_RX_SIZE] __attribute__((aligned(4))); // 32-bits aligned for DMA
 static uint16_t rpl_rx_tail = 0;
-static uint8_t rpl_resp_buf[BUFFER_RESP_SIZE];
+static uint8_t rpl_resp_buf[BUFFER_RESP_SIZE] __attribute__((aligned(4))); // 32-bits aligned for checksum
 static uint8_t rpl_resp_len = 0;
-static response_type_t rpl_resp_type = RESPONSE_UNKNOWN;
+static volatile response_type_t rpl_resp_type = RESPONSE_UNKNOWN;
 static parser_state_t rpl_parser_state = PARSER_DESCRIPTOR;
-static parser_state_t rpl_last_complete_resp = RESPONSE_UNKNOWN;
+static volatile response_type_t rpl_last_complete_resp = RESPONSE_UNKNOWN;
 static uint8_t *rpl_usr_buf = NULL;
 static uint32_t rpl_usr_buf_idx = 0;
-static uint32_t rpl_multiresp_remaining = 0;
+static volatile uint32_t rpl_multiresp_remaining = 0;
+static volatile rplidar_stats_t rpl_stats = {0};
+static rplidar_scan_mode_t rpl_scan_modes[RPLIDAR_SCAN_MODE_MAX];
+static uint8_t rpl_scan_modes_count = 0;
+static int8_t rpl_scan_mode_selected = -1;
+static uint32_t rpl_cycles_per_byte = 0;
+static uint32_t rpl_batch_timestamp = 0;
+static uint16_t rpl_batch_bytes_after = 0;
+static uint32_t rpl_resp_timestamp = 0;
 
 static void _ParseRX(uint8_t *data, uint16_t len);
 static parser_state_t _ParseDescriptor(uint8_t *buf);
@@ -76,6 +102,11 @@ static uint8_t _ComputeChecksum(uint8_t *data, uint16_t size);
 static void _ResetParser(void);
 static bool _WaitForResponse(response_type_t type, uint32_t timeout);
 static bool _WaitForMultiResponse(response_type_t type, uint32_t timeout);
+static bool _StartScanMode(uint8_t mode, rplidar_dense_measurements_t *measurements, uint32_t count,
+                           uint32_t timeout);
+static bool _RequestScanModeConf(uint32_t type, uint16_t mode, void *value, uint8_t size);
+static bool _IsAnswerTypeSupported(uint8_t ans_type);
+static bool _VerifyCapsule(const uint8_t *capsule, uint16_t size);
 
 bool RPLIDAR_Init(UART_HandleTypeDef *huart)
 {
@@ -88,6 +119,11 @@ bool RPLIDAR_Init(UART_HandleTypeDef *huart)
 
     rpl_uart = huart;
 
+    // Cycle counter is used to timestamp received bytes, 10 bits per byte with 8N1 framing
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    rpl_cycles_per_byte = (uint32_t) (((uint64_t) SystemCoreClock * 10) / huart->Init.BaudRate);
+
     if (!RPLIDAR_RequestHealth(&health, 1000) || health.status != 0)
     {
         // Reset to clear errors
@@ -119,26 +155,124 @@ bool RPLIDAR_StartScan(rplidar_measurement_t measurement[], uint32_t count, uint
 
 bool RPLIDAR_StartScanExpress(rplidar_dense_measurements_t *measurements, uint32_t count, uint32_t timeout)
 {
-    uint8_t packet[9] = {START_FLAG, REQ_SCAN_EXPR, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22};
-    packet[8] = _ComputeChecksum(packet, 8);
+    return _StartScanMode(SCAN_MODE_STANDARD, measurements, count, timeout);
+}
 
-    // Use buffer provided by user to store response
-    // If null then use internal buffer and callback
-    rpl_usr_buf = (uint8_t*) measurements;
-    rpl_multiresp_remaining = count;
+bool RPLIDAR_DiscoverScanModes(void)
+{
+    uint16_t count = 0;
+    uint16_t typical = SCAN_MODE_STANDARD;
+    uint32_t best_us_per_sample = UINT32_MAX;
 
-    if (!_SendRequest(packet, sizeof(packet), true))
+    if (rpl_scan_modes_count > 0)
+    {
+        // Already discovered, use cached result
+        return true;
+    }
+
+    rpl_scan_mode_selected = -1;
+    if (!_RequestScanModeConf(CONF_SCAN_MODE_COUNT, 0, &count, sizeof(count)) || count == 0)
     {
+        // Older firmwares do not support configuration requests, only legacy scan is available
         return false;
     }
+    _RequestScanModeConf(CONF_SCAN_MODE_TYPICAL, 0, &typical, sizeof(typical));
 
-    // If user didn't provide a buffer, return immediatly and the callback will be called
-    return rpl_usr_buf != NULL ? _WaitForMultiResponse(RESPONSE_SCAN_EXPRESS, timeout) : true;
+    for (uint16_t id = 0; id < count && rpl_scan_modes_count < RPLIDAR_SCAN_MODE_MAX; id++)
+    {
+        rplidar_scan_mode_t *mode = &rpl_scan_modes[rpl_scan_modes_count];
+        memset(mode, 0, sizeof(rplidar_scan_mode_t));
+        mode->id = id;
+
+        if (!_RequestScanModeConf(CONF_SCAN_MODE_US_PER_SAMPLE, id, &mode->us_per_sample, sizeof(uint32_t))
+                || !_RequestScanModeConf(CONF_SCAN_MODE_ANS_TYPE, id, &mode->answer_type, sizeof(uint8_t)))
+        {
+            continue;
+        }
+        _RequestScanModeConf(CONF_SCAN_MODE_MAX_DISTANCE, id, &mode->max_distance, sizeof(uint32_t));
+        _RequestScanModeConf(CONF_SCAN_MODE_NAME, id, mode->name, sizeof(mode->name) - 1);
+
+        // Keep the highest sample rate among the modes the parser can decode, prefer typical mode on tie
+        if (_IsAnswerTypeSupported(mode->answer_type)
+                && (mode->us_per_sample < best_us_per_sample
+                        || (mode->us_per_sample == best_us_per_sample && id == typical)))
+        {
+            best_us_per_sample = mode->us_per_sample;
+            rpl_scan_mode_selected = rpl_scan_modes_count;
+        }
+        rpl_scan_modes_count++;
+    }
+
+    return rpl_scan_mode_selected >= 0;
+}
+
+uint8_t RPLIDAR_GetScanModes(const rplidar_scan_mode_t **modes)
+{
+    *modes = rpl_scan_modes;
+    return rpl_scan_modes_count;
+}
+
+const rplidar_scan_mode_t* RPLIDAR_GetSelectedScanMode(void)
+{
+    return rpl_scan_mode_selected >= 0 ? &rpl_scan_modes[rpl_scan_mode_selected] : NULL;
+}
+
+bool RPLIDAR_StartSelectedScan(void)
+{
+    const rplidar_scan_mode_t *mode = RPLIDAR_GetSelectedScanMode();
+
+    if (mode == NULL || mode->answer_type == RESP_SCAN)
+    {
+        // Nothing discovered or legacy mode selected
+        return RPLIDAR_StartScan(NULL, 0, 0);
+    }
+    return _StartScanMode(mode->id, NULL, 0, 0);
+}
+
+uint32_t RPLIDAR_GetMeasurementTimestamp(void)
+{
+    return rpl_resp_timestamp;
+}
+
+uint8_t RPLIDAR_DecodeDenseCapsule(const rplidar_dense_measurements_t *capsule,
+                                   const rplidar_dense_measurements_t *next, rplidar_measurement_t measurements[],
+                                   uint32_t capsule_timestamp, uint32_t next_timestamp, uint32_t timestamps[])
+{
+    // A capsule is sent once its samples are measured, so they span the period before its reception
+    uint32_t capsule_duration = next_timestamp - capsule_timestamp;
+
+    int32_t angle_diff = (int32_t) next->angle - (int32_t) capsule->angle;
+    if (angle_diff < 0)
+    {
+        // Angle wrapped around between both capsules
+        angle_diff += ANGLE_Q6_FULL_TURN;
+    }
+
+    for (uint8_t i = 0; i < DENSE_SAMPLES_NB; i++)
+    {
+        uint32_t angle = capsule->angle + (angle_diff * i) / DENSE_SAMPLES_NB;
+        uint32_t distance = (uint32_t) capsule->distance[i] << 2;
+        bool start = (i == 0) && capsule->start;
+
+        measurements[i].start = start ? 0x01 : 0x02;
+        measurements[i].quality = capsule->distance[i] ? DENSE_QUALITY : 0;
+        measurements[i].check = 1;
+        measurements[i].angle = angle >= ANGLE_Q6_FULL_TURN ? angle - ANGLE_Q6_FULL_TURN : angle;
+        measurements[i].distance = distance > UINT16_MAX ? UINT16_MAX : distance;
+        if (timestamps != NULL)
+        {
+            timestamps[i] = capsule_timestamp
+                    - (uint32_t) (((uint64_t) capsule_duration * (DENSE_SAMPLES_NB - i)) / DENSE_SAMPLES_NB);
+        }
+    }
+
+    return DENSE_SAMPLES_NB;
 }
 
 bool RPLIDAR_StopScan(void)
 {
-    uint8_t packet[2] = {START_FLAG, REQ_STOP};
+    // Static as the packet is still read by the DMA after returning, maybe while the flash is erased
+    static uint8_t packet[2] = {START_FLAG, REQ_STOP};
     return _SendRequest(packet, sizeof(packet), false);
 }
 
@@ -158,15 +292,22 @@ bool RPLIDAR_Reset(void)
 
 bool RPLIDAR_SetMotorSpeed(uint16_t rpm)
 {
-    uint8_t packet[6];
+    // Static as the packet is still read by the DMA after returning
+    static uint8_t packet[6];
+    if (rpl_uart->gState != HAL_UART_STATE_READY)
+    {
+        // Previous packet still in flight, do not overwrite it
+        return false;
+    }
     packet[0] = START_FLAG;
     packet[1] = REQ_MOTOR;
     packet[2] = 0x02;
-    packet[3] = (rpm >> 8) & 0xFF;
-    packet[4] = rpm & 0xFF;
+    packet[3] = rpm & 0xFF;
+    packet[4] = (rpm >> 8) & 0xFF;
     packet[5] = _ComputeChecksum(packet, 5);
 
-    return _SendRequest(packet, sizeof(packet), false);
+    // No answer is expected, do not reset the parser to keep receiving scan data
+    return (HAL_UART_Transmit_DMA(rpl_uart, packet, sizeof(packet)) == HAL_OK);
 }
 
 bool RPLIDAR_RequestDeviceInfo(rplidar_info_t *info, uint32_t timeout)
@@ -231,11 +372,12 @@ bool RPLIDAR_RequestConfiguration(uint32_t type, uint8_t *payload, uint16_t payl
 
     packet[0] = START_FLAG;
     packet[1] = REQ_CONF;
-    packet[2] = payload_size + 1;
-    packet[3] = (type >> 24) & 0xFF;
-    packet[4] = (type >> 16) & 0xFF;
-    packet[5] = (type >> 8) & 0xFF;
-    packet[6] = type & 0xFF;
+    packet[2] = payload_size + 4;
+    // Configuration type is sent little-endian
+    packet[3] = type & 0xFF;
+    packet[4] = (type >> 8) & 0xFF;
+    packet[5] = (type >> 16) & 0xFF;
+    packet[6] = (type >> 24) & 0xFF;
     memcpy(&packet[7], payload, payload_size);
     packet[payload_size + 7] = _ComputeChecksum(packet, payload_size + 7);
 
@@ -243,7 +385,7 @@ bool RPLIDAR_RequestConfiguration(uint32_t type, uint8_t *payload, uint16_t payl
     // If null then use internal buffer and callback
     rpl_usr_buf = (uint8_t*) config;
 
-    if (!_SendRequest(packet, sizeof(packet), true))
+    if (!_SendRequest(packet, payload_size + 8, true))
     {
         return false;
     }
@@ -252,6 +394,29 @@ bool RPLIDAR_RequestConfiguration(uint32_t type, uint8_t *payload, uint16_t payl
     return rpl_usr_buf != NULL ? _WaitForResponse(RESPONSE_CONF, timeout) : true;
 }
 
+void RPLIDAR_GetStats(rplidar_stats_t *stats)
+{
+    // Each counter is a single 32-bit word, so reading it is atomic
+    stats->rx_bytes = rpl_stats.rx_bytes;
+    stats->measurements = rpl_stats.measurements;
+    stats->revolutions = rpl_stats.revolutions;
+    stats->revolution_tick = rpl_stats.revolution_tick;
+    stats->parse_errors = rpl_stats.parse_errors;
+    stats->capsule_errors = rpl_stats.capsule_errors;
+}
+
+const uint8_t* RPLIDAR_GetRxBuffer(uint16_t *size)
+{
+    *size = BUFFER_RX_SIZE;
+    return rpl_rx_buf;
+}
+
+uint16_t RPLIDAR_GetRxHead(void)
+{
+    // The DMA counts down the bytes left before the end of the ring
+    return (BUFFER_RX_SIZE - __HAL_DMA_GET_COUNTER(rpl_uart->hdmarx)) % BUFFER_RX_SIZE;
+}
+
 __attribute__((weak)) void RPLIDAR_OnDeviceInfo(rplidar_info_t *info)
 {
     return;
@@ -282,20 +447,50 @@ __attribute__((weak)) void RPLIDAR_OnDenseMeasurements(rplidar_dense_measurement
     return;
 }
 
+__attribute__((weak)) void RPLIDAR_OnRawData(const uint8_t *data, uint16_t length)
+{
+    return;
+}
+
 void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t head)
 {
     if (huart->Instance == rpl_uart->Instance)
     {
+        // The parsing is measured apart, the ISR zone only covers the work around it
+        PROFILE_BEGIN(PROFILE_ZONE_UART_ISR);
+
+        // Last byte of the batch has just been received, except on idle event which comes one frame later
+        rpl_batch_timestamp = DWT->CYCCNT;
+        if (HAL_UARTEx_GetRxEventType(huart) == HAL_UART_RXEVENT_IDLE)
+        {
+            rpl_batch_timestamp -= rpl_cycles_per_byte;
+        }
+
+        uint16_t len;
+        uint16_t wrapped = 0; // Bytes at the start of the buffer if it wrapped around
         if (head > rpl_rx_tail)
         {
-            _ParseRX(&rpl_rx_buf[rpl_rx_tail], head - rpl_rx_tail);
+            len = head - rpl_rx_tail;
         }
         else
         {
-            // Buffer wrapped around
-            _ParseRX(&rpl_rx_buf[rpl_rx_tail], BUFFER_RX_SIZE - rpl_rx_tail);
-            _ParseRX(&rpl_rx_buf[0], head);
+            len = BUFFER_RX_SIZE - rpl_rx_tail;
+            wrapped = head;
         }
+        rpl_stats.rx_bytes += len + wrapped;
+        RPLIDAR_OnRawData(&rpl_rx_buf[rpl_rx_tail], len);
+        if (wrapped > 0)
+        {
+            RPLIDAR_OnRawData(&rpl_rx_buf[0], wrapped);
+        }
+        PROFILE_END(PROFILE_ZONE_UART_ISR);
+
+        PROFILE_BEGIN(PROFILE_ZONE_PARSE_RX);
+        rpl_batch_bytes_after = wrapped;
+        _ParseRX(&rpl_rx_buf[rpl_rx_tail], len);
+        rpl_batch_bytes_after = 0;
+        _ParseRX(&rpl_rx_buf[0], wrapped);
+        PROFILE_END(PROFILE_ZONE_PARSE_RX);
         rpl_rx_tail = head;
     }
 }
@@ -316,6 +511,10 @@ static void _ParseRX(uint8_t *data, uint16_t len)
                         // Entire descriptor (7 bytes) received
                         rpl_parser_state = _ParseDescriptor(rpl_desc_buf);
                         rpl_desc_idx = 0;
+                        if (rpl_parser_state == PARSER_ERROR)
+                        {
+                            rpl_stats.parse_errors++;
+                        }
                     }
                 }
                 break;
@@ -326,7 +525,9 @@ static void _ParseRX(uint8_t *data, uint16_t len)
                     rpl_resp_buf[rpl_resp_idx++] = data[i];
                     if (rpl_resp_idx == rpl_resp_len)
                     {
-                        // Entire response received
+                        // Entire response received, interpolate its reception time from its position in the batch
+                        rpl_resp_timestamp = rpl_batch_timestamp
+                                - (uint32_t) (len - 1 - i + rpl_batch_bytes_after) * rpl_cycles_per_byte;
                         if (_ParseResponse(rpl_resp_buf, rpl_resp_len))
                         {
                             // Parsing complete
@@ -343,6 +544,7 @@ static void _ParseRX(uint8_t *data, uint16_t len)
                         else
                         {
                             rpl_parser_state = PARSER_ERROR;
+                            rpl_stats.parse_errors++;
                         }
                         // Reset response buffer
                         rpl_resp_idx = 0;
@@ -422,11 +624,16 @@ static bool _ParseResponse(uint8_t *response, uint16_t size)
                         | response[0], .payload_size = size - 4, .payload = response + 4, };
                 if (rpl_usr_buf != NULL)
                 {
-                    // Use user buffer
-                    memcpy(rpl_usr_buf, &config, sizeof(rplidar_configuration_t));
-                    // Copy payload to end of user buffer
-                    memcpy(((rplidar_configuration_t*) rpl_usr_buf)->payload, response + 4, size - 4);
-                    rpl_last_complete_resp = RESPONSE_SAMPLERATE;
+                    // Use user buffer, payload is copied to the user payload buffer within its capacity
+                    rplidar_configuration_t *usr_config = (rplidar_configuration_t*) rpl_usr_buf;
+                    if (config.payload_size > usr_config->payload_size)
+                    {
+                        config.payload_size = usr_config->payload_size;
+                    }
+                    usr_config->type = config.type;
+                    usr_config->payload_size = config.payload_size;
+                    memcpy(usr_config->payload, config.payload, config.payload_size);
+                    rpl_last_complete_resp = RESPONSE_CONF;
                 }
                 else
                 {
@@ -444,6 +651,13 @@ static bool _ParseResponse(uint8_t *response, uint16_t size)
                     return false;
                 }
 
+                rpl_stats.measurements++;
+                if (measurement->start & 0x01)
+                {
+                    rpl_stats.revolutions++;
+                    rpl_stats.revolution_tick = HAL_GetTick();
+                }
+
                 if (rpl_usr_buf != NULL)
                 {
                     // Use user buffer
@@ -469,6 +683,20 @@ static bool _ParseResponse(uint8_t *response, uint16_t size)
             if (size == sizeof(rplidar_dense_measurements_t))
             {
                 rplidar_dense_measurements_t *measurements = (rplidar_dense_measurements_t*) response;
+                if (!_VerifyCapsule(response, size))
+                {
+                    // Drop corrupted capsule but keep the stream running
+                    rpl_stats.capsule_errors++;
+                    return true;
+                }
+
+                rpl_stats.measurements += sizeof(measurements->distance) / sizeof(measurements->distance[0]);
+                if (measurements->start)
+                {
+                    rpl_stats.revolutions++;
+                    rpl_stats.revolution_tick = HAL_GetTick();
+                }
+
                 if (rpl_usr_buf != NULL)
                 {
                     // Use user buffer
@@ -570,7 +798,7 @@ static uint8_t _ComputeChecksum(uint8_t *data, uint16_t size)
     uint8_t checksum = 0;
     for (uint16_t i = 0; i < size; i++)
     {
-        checksum += data[i];
+        checksum ^= data[i];
     }
     return checksum;
 }
@@ -589,7 +817,7 @@ static void _ResetParser(void)
 static bool _WaitForResponse(response_type_t type, uint32_t timeout)
 {
     uint32_t start = HAL_GetTick();
-    while (rpl_resp_type != type)
+    while (rpl_last_complete_resp != type)
     {
         if ((timeout != 0) && ((HAL_GetTick() - start) > timeout))
         {
@@ -613,3 +841,73 @@ static bool _WaitForMultiResponse(response_type_t type, uint32_t timeout)
 
     return true;
 }
+
+static bool _StartScanMode(uint8_t mode, rplidar_dense_measurements_t *measurements, uint32_t count,
+                           uint32_t timeout)
+{
+    uint8_t packet[9] = {START_FLAG, REQ_SCAN_EXPR, 0x05, mode, 0x00, 0x00, 0x00, 0x00, 0x00};
+    packet[8] = _ComputeChecksum(packet, 8);
+
+    // Use buffer provided by user to store response
+    // If null then use internal buffer and callback
+    rpl_usr_buf = (uint8_t*) measurements;
+    rpl_multiresp_remaining = count;
+
+    if (!_SendRequest(packet, sizeof(packet), true))
+    {
+        return false;
+    }
+
+    // If user didn't provide a buffer, return immediatly and the callback will be called
+    return rpl_usr_buf != NULL ? _WaitForMultiResponse(RESPONSE_SCAN_EXPRESS, timeout) : true;
+}
+
+static bool _RequestScanModeConf(uint32_t type, uint16_t mode, void *value, uint8_t size)
+{
+    uint8_t payload[2] = {mode & 0xFF, (mode >> 8) & 0xFF};
+    rplidar_configuration_t config = {.payload_size = size, .payload = value};
+
+    // Scan mode count and typical mode requests do not take the mode as payload
+    uint16_t payload_size = (type == CONF_SCAN_MODE_COUNT || type == CONF_SCAN_MODE_TYPICAL) ? 0 : sizeof(payload);
+
+    if (!RPLIDAR_RequestConfiguration(type, payload, payload_size, &config, SCAN_MODE_REQUEST_TIMEOUT))
+    {
+        return false;
+    }
+    return config.type == type;
+}
+
+static bool _IsAnswerTypeSupported(uint8_t ans_type)
+{
+    return (_ParseRspType(ans_type) == RESPONSE_SCAN) || (_ParseRspType(ans_type) == RESPONSE_SCAN_EXPRESS);
+}
+
+/* Check sync nibbles and checksum (XOR of all bytes following the two header bytes) of a capsule */
+static bool _VerifyCapsule(const uint8_t *capsule, uint16_t size)
+{
+    const uint32_t *words = (const uint32_t*) capsule;
+    uint32_t checksum32 = 0;
+    uint16_t i;
+
+    if ((capsule[0] >> 4) != CAPSULE_SYNC1 || (capsule[1] >> 4) != CAPSULE_SYNC2)
+    {
+        return false;
+    }
+
+    // XOR whole words from the aligned start, header bytes are removed afterwards as XOR is its own inverse
+    for (i = 0; i < size / sizeof(uint32_t); i++)
+    {
+        checksum32 ^= words[i];
+    }
+    uint8_t checksum = checksum32 ^ (checksum32 >> 8) ^ (checksum32 >> 16) ^ (checksum32 >> 24);
+    for (i = i * sizeof(uint32_t); i < size; i++)
+    {
+        checksum ^= capsule[i];
+    }
+    for (i = 0; i < CAPSULE_HEADER_SIZE; i++)
+    {
+        checksum ^= capsule[i];
+    }
+
+    return checksum == ((capsule[0] & 0x0F) | ((capsule[1] & 0x0F) << 4));
+}
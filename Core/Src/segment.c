@@ -0,0 +1,247 @@
+/*
+ * segment.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "segment.h"
+
+#define SEGMENT_BREAK_MIN_MM 100.0f // Gap between two consecutive samples starting a new part
+#define SEGMENT_BREAK_RATIO 0.05f // Extra gap allowed per mm of distance, samples spread with the range
+#define SEGMENT_SPLIT_MM 40.0f // Maximum distance of a sample to its segment
+#define SEGMENT_POINTS_MIN 6
+#define SEGMENT_LENGTH_MIN_MM 200.0f
+#define SEGMENT_STACK_SIZE 32
+
+typedef struct
+{
+    uint16_t first;
+    uint16_t last;
+} segment_range_t;
+
+static float segment_x[SWEEP_SAMPLES_MAX];
+static float segment_y[SWEEP_SAMPLES_MAX];
+static uint8_t segment_quality[SWEEP_SAMPLES_MAX];
+static segment_t segment_buf[SEGMENT_MAX];
+static segment_range_t segment_range[SEGMENT_MAX];
+static uint8_t segment_count = 0;
+
+static void _SplitPart(uint16_t first, uint16_t last);
+static float _FitLine(uint16_t first, uint16_t last, segment_t *segment);
+static bool _IsBreak(uint16_t i);
+static bool _IsWrapBreak(uint16_t count);
+static void _JoinWrapSegments(void);
+
+uint8_t SEGMENT_Extract(const sweep_frame_t *sweep)
+{
+    uint16_t count = sweep->count;
+    uint16_t first = 0;
+
+    segment_count = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        float distance_mm = sweep->samples[i].distance / 4.0f;
+        float angle_rad = (sweep->samples[i].angle / 64.0f) * (float) M_PI / 180.0f;
+        segment_x[i] = distance_mm * sinf(angle_rad);
+        segment_y[i] = -distance_mm * cosf(angle_rad);
+        segment_quality[i] = sweep->samples[i].quality;
+    }
+
+    for (uint16_t i = 1; i <= count; i++)
+    {
+        if (i == count || _IsBreak(i))
+        {
+            _SplitPart(first, i - 1);
+            first = i;
+        }
+    }
+
+    // Merge neighbours lying on the same line, which the split can produce around noisy samples
+    uint8_t merged = 0;
+    for (uint8_t i = 1; i < segment_count; i++)
+    {
+        segment_t segment;
+        segment_range_t *prev = &segment_range[merged];
+        if (!_IsBreak(segment_range[i].first) && segment_range[i].first <= prev->last + 1
+                && _FitLine(prev->first, segment_range[i].last, &segment) <= SEGMENT_SPLIT_MM)
+        {
+            prev->last = segment_range[i].last;
+            segment_buf[merged] = segment;
+        }
+        else
+        {
+            merged++;
+            segment_range[merged] = segment_range[i];
+            segment_buf[merged] = segment_buf[i];
+        }
+    }
+    segment_count = segment_count > 0 ? merged + 1 : 0;
+
+    // The wall crossing the start of the revolution is split in two, join the last and first segments back
+    if (segment_count > 2 && segment_range[0].first == 0 && segment_range[segment_count - 1].last == count - 1
+            && !_IsWrapBreak(count))
+    {
+        _JoinWrapSegments();
+    }
+
+    return segment_count;
+}
+
+const segment_t* SEGMENT_GetSegments(uint8_t *count)
+{
+    *count = segment_count;
+    return segment_buf;
+}
+
+/* Iterative split, parts are processed left first so segments stay ordered by angle */
+static void _SplitPart(uint16_t first, uint16_t last)
+{
+    segment_range_t stack[SEGMENT_STACK_SIZE];
+    uint8_t stack_size = 0;
+
+    stack[stack_size++] = (segment_range_t) {first, last};
+    while (stack_size > 0 && segment_count < SEGMENT_MAX)
+    {
+        segment_range_t range = stack[--stack_size];
+        if (range.last - range.first + 1 < SEGMENT_POINTS_MIN)
+        {
+            continue;
+        }
+
+        // Farthest sample from the chord, compared squared to avoid a square root per sample
+        float dx = segment_x[range.last] - segment_x[range.first];
+        float dy = segment_y[range.last] - segment_y[range.first];
+        float length2 = dx * dx + dy * dy;
+        float dist2_max = 0;
+        uint16_t split = range.first;
+        for (uint16_t i = range.first + 1; i < range.last; i++)
+        {
+            float cross = dx * (segment_y[i] - segment_y[range.first]) - dy * (segment_x[i] - segment_x[range.first]);
+            if (cross * cross > dist2_max)
+            {
+                dist2_max = cross * cross;
+                split = i;
+            }
+        }
+
+        if (dist2_max > SEGMENT_SPLIT_MM * SEGMENT_SPLIT_MM * length2 && stack_size + 2 <= SEGMENT_STACK_SIZE)
+        {
+            stack[stack_size++] = (segment_range_t) {split, range.last};
+            stack[stack_size++] = (segment_range_t) {range.first, split};
+        }
+        else if (length2 >= SEGMENT_LENGTH_MIN_MM * SEGMENT_LENGTH_MIN_MM)
+        {
+            segment_t *segment = &segment_buf[segment_count];
+            if (_FitLine(range.first, range.last, segment) <= SEGMENT_SPLIT_MM)
+            {
+                segment_range[segment_count++] = range;
+            }
+        }
+    }
+}
+
+/* Total least squares fit, return the maximum distance of a sample to the line */
+static float _FitLine(uint16_t first, uint16_t last, segment_t *segment)
+{
+    uint16_t count = last - first + 1;
+    float mean_x = 0, mean_y = 0;
+    float sxx = 0, syy = 0, sxy = 0;
+    float error = 0, error_max = 0;
+    uint32_t quality = 0;
+
+    for (uint16_t i = first; i <= last; i++)
+    {
+        mean_x += segment_x[i];
+        mean_y += segment_y[i];
+        quality += segment_quality[i];
+    }
+    mean_x /= count;
+    mean_y /= count;
+
+    for (uint16_t i = first; i <= last; i++)
+    {
+        float dx = segment_x[i] - mean_x;
+        float dy = segment_y[i] - mean_y;
+        sxx += dx * dx;
+        syy += dy * dy;
+        sxy += dx * dy;
+    }
+
+    // Direction of the line is the main axis of the samples
+    float theta = 0.5f * atan2f(2 * sxy, sxx - syy);
+    float ux = cosf(theta);
+    float uy = sinf(theta);
+
+    for (uint16_t i = first; i <= last; i++)
+    {
+        float d = fabsf((segment_y[i] - mean_y) * ux - (segment_x[i] - mean_x) * uy);
+        error += d * d;
+        if (d > error_max)
+        {
+            error_max = d;
+        }
+    }
+
+    // Endpoints are the first and last samples projected on the line
+    float t1 = (segment_x[first] - mean_x) * ux + (segment_y[first] - mean_y) * uy;
+    float t2 = (segment_x[last] - mean_x) * ux + (segment_y[last] - mean_y) * uy;
+    segment->x1 = lroundf(mean_x + t1 * ux);
+    segment->y1 = lroundf(mean_y + t1 * uy);
+    segment->x2 = lroundf(mean_x + t2 * ux);
+    segment->y2 = lroundf(mean_y + t2 * uy);
+    segment->error = lroundf(sqrtf(error / count));
+    segment->count = count;
+    segment->quality = quality / count;
+
+    return error_max;
+}
+
+/* Return true if sample i is too far from the previous one to belong to the same wall */
+static bool _IsBreak(uint16_t i)
+{
+    float dx = segment_x[i] - segment_x[i - 1];
+    float dy = segment_y[i] - segment_y[i - 1];
+    float range = fabsf(segment_x[i]) + fabsf(segment_y[i]);
+    float gap = SEGMENT_BREAK_MIN_MM + range * SEGMENT_BREAK_RATIO;
+    return dx * dx + dy * dy > gap * gap;
+}
+
+/* Same as _IsBreak between the last and the first sample of the sweep */
+static bool _IsWrapBreak(uint16_t count)
+{
+    float dx = segment_x[0] - segment_x[count - 1];
+    float dy = segment_y[0] - segment_y[count - 1];
+    float range = fabsf(segment_x[0]) + fabsf(segment_y[0]);
+    float gap = SEGMENT_BREAK_MIN_MM + range * SEGMENT_BREAK_RATIO;
+    return dx * dx + dy * dy > gap * gap;
+}
+
+/* Merge the last segment into the first one if both lie on the same line */
+static void _JoinWrapSegments(void)
+{
+    segment_t *first = &segment_buf[0];
+    segment_t *last = &segment_buf[segment_count - 1];
+    float dx = first->x2 - last->x1;
+    float dy = first->y2 - last->y1;
+    float length = sqrtf(dx * dx + dy * dy);
+
+    // Both inner endpoints must be close to the joined line
+    float d1 = fabsf(dx * (last->y2 - last->y1) - dy * (last->x2 - last->x1)) / length;
+    float d2 = fabsf(dx * (first->y1 - last->y1) - dy * (first->x1 - last->x1)) / length;
+    if (length == 0.0f || d1 > SEGMENT_SPLIT_MM || d2 > SEGMENT_SPLIT_MM)
+    {
+        return;
+    }
+
+    uint16_t count = first->count + last->count;
+    first->x1 = last->x1;
+    first->y1 = last->y1;
+    first->error = (first->error * first->count + last->error * last->count) / count;
+    first->quality = (first->quality * first->count + last->quality * last->count) / count;
+    first->count = count;
+    segment_count--;
+}
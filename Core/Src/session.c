@@ -0,0 +1,306 @@
+/*
+ * session.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "session.h"
+#include "store.h"
+#include "tile.h"
+
+#define SESSION_VERSION 1
+#define SESSION_ID_HEADER 0 // Chunks are identified by the generation in the high half-word, never 0
+#define SESSION_TAG_DELTA 0x00 // Followed by the signed 8-bit offsets from the previous point
+#define SESSION_TAG_ABSOLUTE 0x40 // Followed by the 16-bit position
+#define SESSION_TAG_MASK 0xC0
+#define SESSION_TAG_QUALITY 0x3F
+#define SESSION_DELTA_SIZE 3
+#define SESSION_ABSOLUTE_SIZE 5
+#define SESSION_TILE_SIZE (TILE_SIZE * TILE_SIZE / 2 + 8) // Worst case of a compressed tile
+
+typedef struct
+{
+    uint16_t version;
+    uint16_t generation;
+    uint16_t chunk_count;
+    uint16_t reserved;
+    session_info_t info;
+} session_header_t;
+
+static session_state_e session_state = SESSION_STATE_IDLE;
+static session_header_t session_header;
+static uint16_t session_previous_generation = 0;
+static uint16_t session_previous_chunks = 0;
+static uint16_t session_point_idx = 0;
+static uint16_t session_cleanup_idx = 0;
+static bool session_saved = false;
+static uint8_t session_chunk[SESSION_CHUNK_SIZE];
+
+static void _End(bool is_saved);
+static bool _GetHeader(session_header_t *header);
+static uint32_t _GetChunkId(uint16_t generation, uint16_t index);
+static uint16_t _EncodeChunk(void);
+static bool _DecodeChunk(const uint8_t *chunk, uint16_t length);
+
+bool SESSION_Save(const session_info_t *info)
+{
+    session_header_t previous;
+
+    if (session_state != SESSION_STATE_IDLE)
+    {
+        return false;
+    }
+
+    if (_GetHeader(&previous))
+    {
+        session_previous_generation = previous.generation;
+        session_previous_chunks = previous.chunk_count;
+    }
+    else
+    {
+        session_previous_generation = 0;
+        session_previous_chunks = 0;
+    }
+
+    uint16_t generation = session_previous_generation + 1;
+    session_header.version = SESSION_VERSION;
+    session_header.generation = generation != 0 ? generation : 1;
+    session_header.chunk_count = 0;
+    session_header.reserved = 0;
+    session_header.info = *info;
+    session_point_idx = 0;
+    session_cleanup_idx = 0;
+    session_saved = false;
+    session_state = SESSION_STATE_RESERVE;
+    return true;
+}
+
+bool SESSION_Update(void)
+{
+    switch (session_state)
+    {
+        default:
+        case SESSION_STATE_IDLE:
+            return false;
+        case SESSION_STATE_RESERVE:
+            if (!SESSION_Reserve(session_header.info.point_count))
+            {
+                _End(false);
+                return true;
+            }
+            session_state = SESSION_STATE_TILES;
+            break;
+        case SESSION_STATE_TILES:
+            // Tile map is already in the store, only the tiles modified in RAM are missing
+            if (!TILE_FlushNext())
+            {
+                session_state = SESSION_STATE_POINTS;
+            }
+            break;
+        case SESSION_STATE_POINTS:
+        {
+            uint16_t length = _EncodeChunk();
+            if (length == 0)
+            {
+                session_state = SESSION_STATE_COMMIT;
+            }
+            else if (STORE_Write(STORE_TYPE_SESSION,
+                                 _GetChunkId(session_header.generation, session_header.chunk_count),
+                                 session_chunk, length))
+            {
+                session_header.chunk_count++;
+            }
+            else
+            {
+                _End(false);
+                return true;
+            }
+            break;
+        }
+        case SESSION_STATE_COMMIT:
+            // The new chunks are only used once the header pointing to them is written
+            if (!STORE_Write(STORE_TYPE_SESSION, SESSION_ID_HEADER, &session_header, sizeof(session_header)))
+            {
+                _End(false);
+                return true;
+            }
+            session_state = SESSION_STATE_CLEANUP;
+            break;
+        case SESSION_STATE_CLEANUP:
+            if (session_previous_generation == 0 || session_cleanup_idx >= session_previous_chunks)
+            {
+                _End(true);
+                return true;
+            }
+            STORE_Delete(STORE_TYPE_SESSION, _GetChunkId(session_previous_generation, session_cleanup_idx++));
+            break;
+    }
+    return false;
+}
+
+bool SESSION_Reserve(uint16_t point_count)
+{
+    session_header_t previous;
+    uint16_t previous_chunks = _GetHeader(&previous) ? previous.chunk_count : 0;
+
+    // Worst case is every point stored with its absolute position
+    uint32_t length = (uint32_t) point_count * SESSION_ABSOLUTE_SIZE;
+    uint16_t count = length / SESSION_CHUNK_SIZE + 1;
+    length += sizeof(session_header_t) + TILE_SLOTS * SESSION_TILE_SIZE;
+    count += 1 + TILE_SLOTS + previous_chunks;
+    return STORE_Reserve(length, count);
+}
+
+session_state_e SESSION_GetState(void)
+{
+    return session_state;
+}
+
+bool SESSION_IsSaved(void)
+{
+    return session_saved;
+}
+
+bool SESSION_GetInfo(session_info_t *info)
+{
+    session_header_t header;
+
+    if (!_GetHeader(&header))
+    {
+        return false;
+    }
+    *info = header.info;
+    return true;
+}
+
+bool SESSION_Load(void)
+{
+    session_header_t header;
+
+    if (!_GetHeader(&header))
+    {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < header.chunk_count; i++)
+    {
+        uint16_t length = 0;
+        const uint8_t *chunk = STORE_Find(STORE_TYPE_SESSION, _GetChunkId(header.generation, i), &length);
+        if (chunk == NULL || !_DecodeChunk(chunk, length))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+__attribute__((weak)) bool SESSION_OnSavePoint(uint16_t index, session_point_t *point)
+{
+    return false;
+}
+
+__attribute__((weak)) void SESSION_OnLoadPoint(const session_point_t *point)
+{
+    return;
+}
+
+static void _End(bool is_saved)
+{
+    session_saved = is_saved;
+    session_state = SESSION_STATE_IDLE;
+}
+
+static bool _GetHeader(session_header_t *header)
+{
+    uint16_t length = 0;
+    const session_header_t *stored = STORE_Find(STORE_TYPE_SESSION, SESSION_ID_HEADER, &length);
+
+    if (stored == NULL || length != sizeof(session_header_t) || stored->version != SESSION_VERSION)
+    {
+        return false;
+    }
+    memcpy(header, stored, sizeof(session_header_t));
+    return true;
+}
+
+static uint32_t _GetChunkId(uint16_t generation, uint16_t index)
+{
+    return ((uint32_t) generation << 16) | index;
+}
+
+static uint16_t _EncodeChunk(void)
+{
+    session_point_t previous = {0};
+    uint16_t length = 0;
+
+    // Consecutive points are close on the screen, most of them are stored as an offset from the previous one
+    while (session_point_idx < session_header.info.point_count && length + SESSION_ABSOLUTE_SIZE <= SESSION_CHUNK_SIZE)
+    {
+        session_point_t point;
+        if (!SESSION_OnSavePoint(session_point_idx, &point))
+        {
+            // The remaining points are not available anymore, the session ends here
+            session_header.info.point_count = session_point_idx;
+            break;
+        }
+        session_point_idx++;
+        if (point.x == 0 && point.y == 0)
+        {
+            continue;
+        }
+
+        int32_t dx = (int32_t) point.x - previous.x;
+        int32_t dy = (int32_t) point.y - previous.y;
+        if (length > 0 && dx >= INT8_MIN && dx <= INT8_MAX && dy >= INT8_MIN && dy <= INT8_MAX)
+        {
+            session_chunk[length++] = SESSION_TAG_DELTA | (point.quality & SESSION_TAG_QUALITY);
+            session_chunk[length++] = (uint8_t) (int8_t) dx;
+            session_chunk[length++] = (uint8_t) (int8_t) dy;
+        }
+        else
+        {
+            // Each chunk starts with an absolute position so that it can be decoded alone
+            session_chunk[length++] = SESSION_TAG_ABSOLUTE | (point.quality & SESSION_TAG_QUALITY);
+            session_chunk[length++] = point.x & 0xFF;
+            session_chunk[length++] = point.x >> 8;
+            session_chunk[length++] = point.y & 0xFF;
+            session_chunk[length++] = point.y >> 8;
+        }
+        previous = point;
+    }
+    return length;
+}
+
+static bool _DecodeChunk(const uint8_t *chunk, uint16_t length)
+{
+    session_point_t point = {0};
+    uint16_t idx = 0;
+
+    while (idx < length)
+    {
+        uint8_t tag = chunk[idx];
+        point.quality = tag & SESSION_TAG_QUALITY;
+        if ((tag & SESSION_TAG_MASK) == SESSION_TAG_DELTA && idx > 0 && idx + SESSION_DELTA_SIZE <= length)
+        {
+            point.x += (int8_t) chunk[idx + 1];
+            point.y += (int8_t) chunk[idx + 2];
+            idx += SESSION_DELTA_SIZE;
+        }
+        else if ((tag & SESSION_TAG_MASK) == SESSION_TAG_ABSOLUTE && idx + SESSION_ABSOLUTE_SIZE <= length)
+        {
+            point.x = chunk[idx + 1] | (chunk[idx + 2] << 8);
+            point.y = chunk[idx + 3] | (chunk[idx + 4] << 8);
+            idx += SESSION_ABSOLUTE_SIZE;
+        }
+        else
+        {
+            return false;
+        }
+        SESSION_OnLoadPoint(&point);
+    }
+    return true;
+}
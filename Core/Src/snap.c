@@ -0,0 +1,107 @@
+/*
+ * snap.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "snap.h"
+
+#define SNAP_CELL_MM 200
+#define SNAP_BUCKETS 256 // Power of 2
+#define SNAP_NONE 0xFFFF
+
+// Ring of points, each bucket chains its points from the newest to the oldest
+static snap_point_t snap_points[SNAP_POINTS_MAX];
+static uint16_t snap_next[SNAP_POINTS_MAX];
+static uint16_t snap_head[SNAP_BUCKETS];
+static uint16_t snap_write_idx = 0;
+static uint16_t snap_count = 0;
+
+static int16_t _GetCell(int16_t value);
+static uint16_t _GetBucket(int16_t cell_x, int16_t cell_y);
+static uint16_t _GetAge(uint16_t idx);
+
+void SNAP_Reset(void)
+{
+    memset(snap_head, 0xFF, sizeof(snap_head));
+    snap_write_idx = 0;
+    snap_count = 0;
+}
+
+void SNAP_AddPoint(const snap_point_t *point)
+{
+    uint16_t bucket = _GetBucket(_GetCell(point->x), _GetCell(point->y));
+
+    // The oldest point is overwritten without unlinking it, chains are cut when a reused slot is reached
+    snap_points[snap_write_idx] = *point;
+    snap_next[snap_write_idx] = snap_head[bucket];
+    snap_head[bucket] = snap_write_idx;
+    snap_write_idx = (snap_write_idx + 1) % SNAP_POINTS_MAX;
+    if (snap_count < SNAP_POINTS_MAX)
+    {
+        snap_count++;
+    }
+}
+
+bool SNAP_FindNearest(const snap_point_t *target, uint16_t radius, snap_point_t *nearest)
+{
+    int32_t dist2_min = (int32_t) radius * radius + 1;
+    int16_t cell_x_min = _GetCell(target->x - radius);
+    int16_t cell_x_max = _GetCell(target->x + radius);
+    int16_t cell_y_min = _GetCell(target->y - radius);
+    int16_t cell_y_max = _GetCell(target->y + radius);
+
+    if (snap_count == 0)
+    {
+        return false;
+    }
+
+    for (int16_t cell_y = cell_y_min; cell_y <= cell_y_max; cell_y++)
+    {
+        for (int16_t cell_x = cell_x_min; cell_x <= cell_x_max; cell_x++)
+        {
+            uint16_t bucket = _GetBucket(cell_x, cell_y);
+            uint16_t idx = snap_head[bucket];
+            uint16_t age = 0;
+
+            while (idx != SNAP_NONE && _GetAge(idx) >= age
+                    && _GetBucket(_GetCell(snap_points[idx].x), _GetCell(snap_points[idx].y)) == bucket)
+            {
+                // Several cells share a bucket, the distance check filters the points of other cells
+                int32_t dx = snap_points[idx].x - target->x;
+                int32_t dy = snap_points[idx].y - target->y;
+                int32_t dist2 = dx * dx + dy * dy;
+                if (dist2 < dist2_min)
+                {
+                    dist2_min = dist2;
+                    *nearest = snap_points[idx];
+                }
+                age = _GetAge(idx) + 1;
+                idx = snap_next[idx];
+            }
+        }
+    }
+
+    return dist2_min <= (int32_t) radius * radius;
+}
+
+/* Floor division, so that cells have the same size on both sides of the sensor */
+static int16_t _GetCell(int16_t value)
+{
+    return value >= 0 ? value / SNAP_CELL_MM : -((-value + SNAP_CELL_MM - 1) / SNAP_CELL_MM);
+}
+
+static uint16_t _GetBucket(int16_t cell_x, int16_t cell_y)
+{
+    return ((uint16_t) cell_x * 73856093u ^ (uint16_t) cell_y * 19349663u) & (SNAP_BUCKETS - 1);
+}
+
+/* Number of points added after this one, a reused slot looks younger than the point linking to it */
+static uint16_t _GetAge(uint16_t idx)
+{
+    return (snap_write_idx + SNAP_POINTS_MAX - 1 - idx) % SNAP_POINTS_MAX;
+}
@@ -0,0 +1,384 @@
+/*
+ * store.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f4xx_hal.h"
+#include "store.h"
+
+#define STORE_MAGIC 0x54534D52 // "RMST"
+#define STORE_SECTOR_SIZE 0x20000 // Sectors 6 and 7, kept out of the program area by the linker script
+#define STORE_END 0xFFFF // Erased record type, end of the log
+#define STORE_ALIGN(x) (((x) + 3) & ~3)
+#define STORE_FNV_OFFSET 2166136261u
+#define STORE_FNV_PRIME 16777619u
+
+typedef struct
+{
+    uint32_t address;
+    uint32_t sector;
+} store_sector_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t sequence; // Incremented by each compaction, the highest valid sector is the active one
+} store_sector_header_t;
+
+typedef struct
+{
+    uint16_t type;
+    uint16_t length; // Payload size, a deletion has no payload
+    uint32_t id;
+    // Followed by the payload padded to a word and its checksum
+} store_record_header_t;
+
+static const store_sector_t store_sectors[2] = {{0x08040000, FLASH_SECTOR_6}, {0x08060000, FLASH_SECTOR_7}};
+
+static bool store_mounted = false;
+static uint8_t store_active = 0;
+static uint32_t store_sequence = 0;
+static uint32_t store_offset = 0; // Write position in the active sector
+static uint32_t store_records = 0;
+static uint32_t store_compactions = 0;
+static uint32_t store_errors = 0;
+
+static bool _Mount(uint8_t sector);
+static bool _Compact(void);
+static bool _Append(uint16_t type, uint32_t id, const void *data, uint16_t length);
+static bool _IsLive(uint8_t sector, uint32_t offset);
+static bool _IsValid(const store_record_header_t *record);
+static uint32_t _Checksum(const store_record_header_t *record, const void *data);
+static const store_sector_header_t* _GetSectorHeader(uint8_t sector);
+static const store_record_header_t* _GetRecord(uint8_t sector, uint32_t offset);
+static uint32_t _GetRecordSize(uint16_t length);
+static bool _Erase(uint8_t sector);
+static bool _Program(uint32_t address, const void *data, uint32_t length);
+
+bool STORE_Init(void)
+{
+    const store_sector_header_t *header[2] = {_GetSectorHeader(0), _GetSectorHeader(1)};
+    bool valid[2] = {header[0]->magic == STORE_MAGIC, header[1]->magic == STORE_MAGIC};
+
+    store_mounted = false;
+    if (valid[0] || valid[1])
+    {
+        // An interrupted compaction leaves the new sector without header, the previous one is still used
+        store_active = (valid[1] && (!valid[0] || header[1]->sequence > header[0]->sequence)) ? 1 : 0;
+        store_sequence = header[store_active]->sequence;
+        store_mounted = _Mount(store_active);
+    }
+    else
+    {
+        // First use, start an empty log in the first sector
+        store_sequence = 0;
+        store_active = 1;
+        store_offset = sizeof(store_sector_header_t);
+        store_mounted = _Compact();
+    }
+    return store_mounted;
+}
+
+bool STORE_Write(uint16_t type, uint32_t id, const void *data, uint16_t length)
+{
+    if (!store_mounted || type == STORE_END || id == STORE_ID_ALL || length == 0 || length > STORE_RECORD_MAX)
+    {
+        return false;
+    }
+    return _Append(type, id, data, length);
+}
+
+bool STORE_Reserve(uint32_t length, uint16_t count)
+{
+    uint32_t size = length + count * _GetRecordSize(0) + count * 3; // Headers, checksums and padding
+
+    if (!store_mounted)
+    {
+        return false;
+    }
+    if (store_offset + size > STORE_SECTOR_SIZE && !_Compact())
+    {
+        return false;
+    }
+    return store_offset + size <= STORE_SECTOR_SIZE;
+}
+
+bool STORE_Delete(uint16_t type, uint32_t id)
+{
+    if (!store_mounted || type == STORE_END)
+    {
+        return false;
+    }
+    return _Append(type, id, NULL, 0);
+}
+
+const void* STORE_Find(uint16_t type, uint32_t id, uint16_t *length)
+{
+    const store_record_header_t *found = NULL;
+    uint32_t offset = sizeof(store_sector_header_t);
+
+    if (!store_mounted)
+    {
+        return NULL;
+    }
+
+    // Checksums are verified when mounting, only the headers are walked here
+    while (offset < store_offset)
+    {
+        const store_record_header_t *record = _GetRecord(store_active, offset);
+        if (record->type == type && (record->id == id || record->id == STORE_ID_ALL))
+        {
+            found = record;
+        }
+        offset += _GetRecordSize(record->length);
+    }
+
+    if (found == NULL || found->length == 0)
+    {
+        return NULL;
+    }
+    *length = found->length;
+    return found + 1;
+}
+
+void STORE_GetStats(store_stats_t *stats)
+{
+    stats->records = store_records;
+    stats->used = store_mounted ? store_offset : 0;
+    stats->size = STORE_SECTOR_SIZE;
+    stats->compactions = store_compactions;
+    stats->errors = store_errors;
+}
+
+__attribute__((weak)) void STORE_OnEraseStart(void)
+{
+    return;
+}
+
+__attribute__((weak)) void STORE_OnEraseEnd(void)
+{
+    return;
+}
+
+static bool _Mount(uint8_t sector)
+{
+    uint32_t offset = sizeof(store_sector_header_t);
+    bool is_clean = true;
+
+    store_records = 0;
+    while (offset + sizeof(store_record_header_t) <= STORE_SECTOR_SIZE)
+    {
+        const store_record_header_t *record = _GetRecord(sector, offset);
+        if (record->type == STORE_END)
+        {
+            break;
+        }
+
+        uint32_t size = _GetRecordSize(record->length);
+        if (record->length > STORE_RECORD_MAX || offset + size > STORE_SECTOR_SIZE)
+        {
+            // Header is corrupted, the rest of the sector cannot be walked
+            is_clean = false;
+            break;
+        }
+        if (!_IsValid(record))
+        {
+            // Write interrupted by a power loss
+            is_clean = false;
+        }
+        offset += size;
+        store_records++;
+    }
+    store_offset = offset;
+
+    // Damaged records are dropped by copying the log, so that lookups can trust every header
+    return is_clean || _Compact();
+}
+
+static bool _Compact(void)
+{
+    uint8_t src = store_active;
+    uint8_t dst = store_active ^ 1;
+    uint32_t src_offset = sizeof(store_sector_header_t);
+    uint32_t dst_offset = sizeof(store_sector_header_t);
+    uint32_t records = 0;
+
+    store_compactions++;
+    STORE_OnEraseStart();
+    bool is_erased = _Erase(dst);
+    STORE_OnEraseEnd();
+    if (!is_erased)
+    {
+        store_errors++;
+        return false;
+    }
+
+    while (src_offset < store_offset)
+    {
+        const store_record_header_t *record = _GetRecord(src, src_offset);
+        uint32_t size = _GetRecordSize(record->length);
+        if (_IsLive(src, src_offset))
+        {
+            if (!_Program(store_sectors[dst].address + dst_offset, record, size))
+            {
+                store_errors++;
+                return false;
+            }
+            dst_offset += size;
+            records++;
+        }
+        src_offset += size;
+    }
+
+    // Header is written last, the previous sector stays active until the copy is complete
+    store_sector_header_t header = {.magic = STORE_MAGIC, .sequence = store_sequence + 1};
+    if (!_Program(store_sectors[dst].address, &header, sizeof(header)))
+    {
+        store_errors++;
+        return false;
+    }
+    store_active = dst;
+    store_sequence = header.sequence;
+    store_offset = dst_offset;
+    store_records = records;
+    return true;
+}
+
+static bool _Append(uint16_t type, uint32_t id, const void *data, uint16_t length)
+{
+    uint32_t size = _GetRecordSize(length);
+
+    if (store_offset + size > STORE_SECTOR_SIZE && !_Compact())
+    {
+        return false;
+    }
+    if (store_offset + size > STORE_SECTOR_SIZE)
+    {
+        // Live records fill the whole sector
+        store_errors++;
+        return false;
+    }
+
+    store_record_header_t header = {.type = type, .length = length, .id = id};
+    uint32_t checksum = _Checksum(&header, data);
+    uint32_t address = store_sectors[store_active].address + store_offset;
+
+    // Header first, so that the log can always be walked even if the payload is not complete
+    bool is_written = _Program(address, &header, sizeof(header))
+            && _Program(address + sizeof(header), data, length)
+            && _Program(address + size - sizeof(checksum), &checksum, sizeof(checksum));
+    store_offset += size;
+    store_records++;
+
+    if (!is_written)
+    {
+        store_errors++;
+        _Compact();
+    }
+    return is_written;
+}
+
+static bool _IsLive(uint8_t sector, uint32_t offset)
+{
+    const store_record_header_t *record = _GetRecord(sector, offset);
+
+    if (record->length == 0 || !_IsValid(record))
+    {
+        // Deletions only matter for the records before them, which are not copied
+        return false;
+    }
+
+    offset += _GetRecordSize(record->length);
+    while (offset < store_offset)
+    {
+        const store_record_header_t *next = _GetRecord(sector, offset);
+        if (next->type == record->type && (next->id == record->id || next->id == STORE_ID_ALL) && _IsValid(next))
+        {
+            return false;
+        }
+        offset += _GetRecordSize(next->length);
+    }
+    return true;
+}
+
+static bool _IsValid(const store_record_header_t *record)
+{
+    const uint32_t *checksum = (const uint32_t*) ((const uint8_t*) record + _GetRecordSize(record->length)) - 1;
+    return *checksum == _Checksum(record, record + 1);
+}
+
+static uint32_t _Checksum(const store_record_header_t *record, const void *data)
+{
+    // FNV-1a over the header and the payload
+    const uint8_t *bytes = (const uint8_t*) record;
+    uint32_t hash = STORE_FNV_OFFSET;
+
+    for (uint8_t i = 0; i < sizeof(store_record_header_t); i++)
+    {
+        hash = (hash ^ bytes[i]) * STORE_FNV_PRIME;
+    }
+    bytes = data;
+    for (uint16_t i = 0; i < record->length; i++)
+    {
+        hash = (hash ^ bytes[i]) * STORE_FNV_PRIME;
+    }
+    return hash;
+}
+
+static const store_sector_header_t* _GetSectorHeader(uint8_t sector)
+{
+    return (const store_sector_header_t*) store_sectors[sector].address;
+}
+
+static const store_record_header_t* _GetRecord(uint8_t sector, uint32_t offset)
+{
+    return (const store_record_header_t*) (store_sectors[sector].address + offset);
+}
+
+static uint32_t _GetRecordSize(uint16_t length)
+{
+    return sizeof(store_record_header_t) + STORE_ALIGN(length) + sizeof(uint32_t);
+}
+
+static bool _Erase(uint8_t sector)
+{
+    FLASH_EraseInitTypeDef erase = {.TypeErase = FLASH_TYPEERASE_SECTORS, .Sector = store_sectors[sector].sector,
+            .NbSectors = 1, .VoltageRange = FLASH_VOLTAGE_RANGE_3};
+    uint32_t sector_error = 0;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR |
+                           FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+    HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&erase, &sector_error);
+    HAL_FLASH_Lock();
+    return status == HAL_OK;
+}
+
+static bool _Program(uint32_t address, const void *data, uint32_t length)
+{
+    const uint8_t *bytes = data;
+    bool is_written = true;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR |
+                           FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+    for (uint32_t i = 0; i < length && is_written; i += sizeof(uint32_t))
+    {
+        // Last word is padded with the erased value
+        uint32_t word = 0xFFFFFFFF;
+        memcpy(&word, &bytes[i], length - i < sizeof(uint32_t) ? length - i : sizeof(uint32_t));
+        is_written = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address + i, word) == HAL_OK;
+    }
+    HAL_FLASH_Lock();
+
+    // Words read before being programmed may still be in the data cache
+    __HAL_FLASH_DATA_CACHE_DISABLE();
+    __HAL_FLASH_DATA_CACHE_RESET();
+    __HAL_FLASH_DATA_CACHE_ENABLE();
+    return is_written;
+}
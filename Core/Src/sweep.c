@@ -0,0 +1,116 @@
+/*
+ * sweep.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f4xx_hal.h"
+#include "sweep.h"
+
+// Single buffer, the completed sweep is processed before the next sample is added
+static sweep_frame_t sweep_frame;
+static bool sweep_completed = false;
+static uint32_t sweep_index = 0;
+static rplidar_measurement_t sweep_first; // First sample of the next sweep, received with the start flag
+static uint32_t sweep_first_timestamp;
+
+static void _StartSweep(void);
+static void _AppendSample(const rplidar_measurement_t *measurement, uint32_t timestamp);
+static bool _IsBetter(const rplidar_measurement_t *measurement, const sweep_sample_t *sample);
+
+void SWEEP_Reset(void)
+{
+    _StartSweep();
+}
+
+bool SWEEP_AddSample(const rplidar_measurement_t *measurement, uint32_t timestamp)
+{
+    if (sweep_completed)
+    {
+        // Last sweep has been processed, assemble the next one in its place
+        _StartSweep();
+        _AppendSample(&sweep_first, sweep_first_timestamp);
+    }
+
+    if ((measurement->start & 0x01) && sweep_frame.count > 0)
+    {
+        // New revolution, publish the current sweep and keep the sample for the next one
+        sweep_frame.index = sweep_index++;
+        sweep_completed = true;
+        sweep_first = *measurement;
+        sweep_first_timestamp = timestamp;
+        return true;
+    }
+
+    _AppendSample(measurement, timestamp);
+    return false;
+}
+
+const sweep_frame_t* SWEEP_GetFrame(void)
+{
+    return sweep_completed ? &sweep_frame : NULL;
+}
+
+uint32_t SWEEP_CyclesToUs(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000);
+}
+
+static void _StartSweep(void)
+{
+    sweep_frame.count = 0;
+    sweep_frame.decimated = 0;
+    sweep_frame.truncated = false;
+    sweep_completed = false;
+}
+
+static void _AppendSample(const rplidar_measurement_t *measurement, uint32_t timestamp)
+{
+    sweep_frame_t *frame = &sweep_frame;
+    sweep_sample_t *sample;
+
+    if (frame->count == 0)
+    {
+        frame->start_timestamp = timestamp;
+    }
+    frame->end_timestamp = timestamp;
+
+    sample = &frame->samples[frame->count > 0 ? frame->count - 1 : 0];
+    if (frame->count > 0
+            && (sample->angle >> SWEEP_ANGLE_BIN_SHIFT) == (measurement->angle >> SWEEP_ANGLE_BIN_SHIFT))
+    {
+        // Same angle bin as the previous sample, only one of them is kept
+        frame->decimated++;
+        if (!_IsBetter(measurement, sample))
+        {
+            return;
+        }
+    }
+    else if (frame->count < SWEEP_SAMPLES_MAX)
+    {
+        sample = &frame->samples[frame->count++];
+    }
+    else
+    {
+        frame->truncated = true;
+        return;
+    }
+
+    sample->timestamp = timestamp;
+    sample->angle = measurement->angle;
+    sample->distance = measurement->distance;
+    sample->quality = measurement->quality;
+}
+
+/* A valid distance first, then the best quality */
+static bool _IsBetter(const rplidar_measurement_t *measurement, const sweep_sample_t *sample)
+{
+    if ((measurement->distance == 0) != (sample->distance == 0))
+    {
+        return measurement->distance != 0;
+    }
+    return measurement->quality > sample->quality;
+}
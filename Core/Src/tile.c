@@ -0,0 +1,554 @@
+/*
+ * tile.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Nicolas BESNARD
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "stm32f4xx_hal.h"
+#include "tile.h"
+#include "store.h"
+
+#define TILE_CELL_BYTES (TILE_SIZE * TILE_SIZE / 2) // Two 4-bit cells per byte
+#define TILE_PACKED_MAX (TILE_CELL_BYTES + TILE_CELL_BYTES / 128 + 1) // Worst case of the run-length encoding
+#define TILE_RUN_MIN 3 // Shorter repeats are stored as literals
+#define TILE_RUN_MAX (0x7F + TILE_RUN_MIN)
+#define TILE_LITERAL_MAX 0x80
+#define TILE_COORD_MASK 0x3FFF // Tile coordinates are packed on 14 bits in the record identifier
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t use; // Access counter value of the last use
+    bool valid;
+    bool dirty;
+    bool merge; // Taken without reading the flash, the stored hits are not counted yet
+    uint8_t cells[TILE_CELL_BYTES];
+} tile_slot_t;
+
+typedef struct
+{
+    int16_t cell_x; // Cell coordinates in the map frame
+    int16_t cell_y;
+    uint8_t level;
+} tile_hit_t;
+
+static const uint16_t tile_cell_size[TILE_LEVEL_MAX] = {[TILE_LEVEL_FINE] = 100, [TILE_LEVEL_COARSE] = 800};
+// Samples seen from one place span less than a tile side, so 2x2 tiles at most
+static const uint16_t tile_level_range[TILE_LEVEL_MAX] = {[TILE_LEVEL_FINE] = 1500, [TILE_LEVEL_COARSE] = 12000};
+
+static tile_slot_t tile_slots[TILE_LEVEL_MAX][TILE_SLOTS_LEVEL];
+static tile_hit_t tile_pending[TILE_PENDING_MAX];
+static uint8_t tile_pending_count = 0;
+static uint8_t tile_pack_buf[TILE_PACKED_MAX];
+static uint32_t tile_use = 0;
+static uint8_t tile_last[TILE_LEVEL_MAX] = {0}; // Consecutive samples mostly fall in the same tile
+static uint32_t tile_loaded = 0;
+static uint32_t tile_written = 0;
+static uint32_t tile_failed = 0;
+static uint32_t tile_dropped = 0;
+
+static uint32_t _GetId(tile_level_e level, int32_t cell_x, int32_t cell_y, uint16_t *cell);
+static tile_slot_t* _FindSlot(tile_level_e level, uint32_t id);
+static tile_slot_t* _GetVictim(tile_level_e level);
+static tile_slot_t* _GetSpare(tile_level_e level);
+static void _KeepSpares(tile_level_e level);
+static void _AddHit(tile_slot_t *slot, uint16_t cell);
+static void _ReplayPending(void);
+static void _Load(tile_slot_t *slot, uint32_t id);
+static void _Merge(tile_slot_t *slot);
+static void _Write(tile_slot_t *slot);
+static uint16_t _Pack(const uint8_t *cells, uint8_t *packed);
+static bool _AddPacked(const uint8_t *packed, uint16_t length, uint8_t *cells);
+static uint8_t _AddCells(uint8_t cells, uint8_t added);
+static uint8_t _UnpackCell(const uint8_t *packed, uint16_t length, uint16_t cell);
+static uint8_t _GetHits(const uint8_t *cells, uint16_t cell);
+static int32_t _FloorDiv(int32_t value, int32_t divisor);
+
+void TILE_Reset(void)
+{
+    for (uint8_t level = 0; level < TILE_LEVEL_MAX; level++)
+    {
+        for (uint8_t i = 0; i < TILE_SLOTS_LEVEL; i++)
+        {
+            tile_slots[level][i].valid = false;
+        }
+    }
+    tile_pending_count = 0;
+    STORE_Delete(STORE_TYPE_TILE, STORE_ID_ALL);
+}
+
+void TILE_AddPoint(int32_t x, int32_t y, uint16_t distance)
+{
+    for (uint8_t level = 0; level < TILE_LEVEL_MAX; level++)
+    {
+        if (distance > tile_level_range[level])
+        {
+            continue;
+        }
+
+        int32_t cell_x = _FloorDiv(x, tile_cell_size[level]);
+        int32_t cell_y = _FloorDiv(y, tile_cell_size[level]);
+        uint16_t cell;
+        uint32_t id = _GetId(level, cell_x, cell_y, &cell);
+        tile_slot_t *slot = _FindSlot(level, id);
+        if (slot == NULL)
+        {
+            // Tile entered during the revolution, its stored hits are added from the main loop
+            slot = _GetSpare(level);
+            if (slot != NULL)
+            {
+                memset(slot->cells, 0, sizeof(slot->cells));
+                slot->id = id;
+                slot->valid = true;
+                slot->dirty = false;
+                slot->merge = true;
+            }
+        }
+
+        if (slot != NULL)
+        {
+            slot->use = ++tile_use;
+            _AddHit(slot, cell);
+        }
+        else if (tile_pending_count < TILE_PENDING_MAX)
+        {
+            // Tile is paged in later from the main loop
+            tile_hit_t *hit = &tile_pending[tile_pending_count++];
+            hit->cell_x = cell_x;
+            hit->cell_y = cell_y;
+            hit->level = level;
+        }
+        else
+        {
+            tile_dropped++;
+        }
+    }
+}
+
+void TILE_Update(void)
+{
+    uint16_t cell;
+
+    for (uint8_t level = 0; level < TILE_LEVEL_MAX; level++)
+    {
+        for (uint8_t i = 0; i < TILE_SLOTS_LEVEL; i++)
+        {
+            if (tile_slots[level][i].valid && tile_slots[level][i].merge)
+            {
+                _Merge(&tile_slots[level][i]);
+            }
+        }
+    }
+    _ReplayPending();
+
+    // Tiles of the queued hits, each slot is paged in once at most so that two hits cannot evict each other forever
+    for (uint8_t n = 0; n < TILE_SLOTS && tile_pending_count > 0; n++)
+    {
+        const tile_hit_t *hit = &tile_pending[0];
+        tile_slot_t *slot = _GetVictim(hit->level);
+        if (slot->valid && slot->dirty)
+        {
+            _Write(slot);
+        }
+        _Load(slot, _GetId(hit->level, hit->cell_x, hit->cell_y, &cell));
+        slot->use = ++tile_use;
+        _ReplayPending();
+    }
+
+    for (uint8_t level = 0; level < TILE_LEVEL_MAX; level++)
+    {
+        _KeepSpares(level);
+    }
+}
+
+void TILE_GetRow(tile_level_e level, int32_t x, int32_t y, int32_t step, uint16_t count, uint8_t *hits)
+{
+    const tile_slot_t *slot = NULL;
+    const uint8_t *packed = NULL;
+    uint16_t length = 0;
+    uint32_t tile_id = 0;
+
+    if (level >= TILE_LEVEL_MAX)
+    {
+        memset(hits, 0, count);
+        return;
+    }
+
+    int32_t cell_y = _FloorDiv(y, tile_cell_size[level]);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint16_t cell;
+        uint32_t id = _GetId(level, _FloorDiv(x + i * step, tile_cell_size[level]), cell_y, &cell);
+        if (i == 0 || id != tile_id)
+        {
+            tile_id = id;
+            slot = _FindSlot(level, id);
+            packed = (slot == NULL || slot->merge) ? STORE_Find(STORE_TYPE_TILE, id, &length) : NULL;
+        }
+
+        hits[i] = slot != NULL ? _GetHits(slot->cells, cell) : 0;
+        if (packed != NULL)
+        {
+            hits[i] += _UnpackCell(packed, length, cell);
+            hits[i] = hits[i] < TILE_HITS_MAX ? hits[i] : TILE_HITS_MAX;
+        }
+    }
+}
+
+uint16_t TILE_GetCellSize(tile_level_e level)
+{
+    return level < TILE_LEVEL_MAX ? tile_cell_size[level] : 0;
+}
+
+void TILE_Flush(void)
+{
+    while (TILE_FlushNext())
+    {
+    }
+}
+
+bool TILE_FlushNext(void)
+{
+    for (uint8_t level = 0; level < TILE_LEVEL_MAX; level++)
+    {
+        for (uint8_t i = 0; i < TILE_SLOTS_LEVEL; i++)
+        {
+            if (tile_slots[level][i].valid && tile_slots[level][i].dirty)
+            {
+                _Write(&tile_slots[level][i]);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void TILE_GetStats(tile_stats_t *stats)
+{
+    stats->loaded = tile_loaded;
+    stats->written = tile_written;
+    stats->failed = tile_failed;
+    stats->dropped = tile_dropped;
+    stats->pending = tile_pending_count;
+    stats->resident = 0;
+    for (uint8_t level = 0; level < TILE_LEVEL_MAX; level++)
+    {
+        for (uint8_t i = 0; i < TILE_SLOTS_LEVEL; i++)
+        {
+            stats->resident += tile_slots[level][i].valid;
+        }
+    }
+}
+
+/* Identifier of the tile containing a cell, and index of the cell in the tile */
+static uint32_t _GetId(tile_level_e level, int32_t cell_x, int32_t cell_y, uint16_t *cell)
+{
+    // Offset by half a tile so that the origin is at the centre of its tile
+    int32_t tile_x = _FloorDiv(cell_x + TILE_SIZE / 2, TILE_SIZE);
+    int32_t tile_y = _FloorDiv(cell_y + TILE_SIZE / 2, TILE_SIZE);
+
+    *cell = (cell_y + TILE_SIZE / 2 - tile_y * TILE_SIZE) * TILE_SIZE + (cell_x + TILE_SIZE / 2 - tile_x * TILE_SIZE);
+    return ((uint32_t) level << 28) | ((tile_y & TILE_COORD_MASK) << 14) | (tile_x & TILE_COORD_MASK);
+}
+
+static tile_slot_t* _FindSlot(tile_level_e level, uint32_t id)
+{
+    tile_slot_t *slots = tile_slots[level];
+
+    if (slots[tile_last[level]].valid && slots[tile_last[level]].id == id)
+    {
+        return &slots[tile_last[level]];
+    }
+    for (uint8_t i = 0; i < TILE_SLOTS_LEVEL; i++)
+    {
+        if (slots[i].valid && slots[i].id == id)
+        {
+            tile_last[level] = i;
+            return &slots[i];
+        }
+    }
+    return NULL;
+}
+
+/* Free slot of the level, otherwise the least recently used one */
+static tile_slot_t* _GetVictim(tile_level_e level)
+{
+    tile_slot_t *slots = tile_slots[level];
+    uint8_t victim = 0;
+
+    for (uint8_t i = 0; i < TILE_SLOTS_LEVEL; i++)
+    {
+        if (!slots[i].valid)
+        {
+            return &slots[i];
+        }
+        if (slots[i].use < slots[victim].use)
+        {
+            victim = i;
+        }
+    }
+    return &slots[victim];
+}
+
+/* Free slot of the level, otherwise the least recently used clean one, NULL if all of them must be written */
+static tile_slot_t* _GetSpare(tile_level_e level)
+{
+    tile_slot_t *slots = tile_slots[level];
+    tile_slot_t *spare = NULL;
+
+    for (uint8_t i = 0; i < TILE_SLOTS_LEVEL; i++)
+    {
+        if (!slots[i].valid)
+        {
+            return &slots[i];
+        }
+        if (!slots[i].dirty && (spare == NULL || slots[i].use < spare->use))
+        {
+            spare = &slots[i];
+        }
+    }
+    return spare;
+}
+
+/* Write the least recently used modified tiles until enough slots can be taken without writing the flash */
+static void _KeepSpares(tile_level_e level)
+{
+    tile_slot_t *slots = tile_slots[level];
+    uint8_t spares = 0;
+
+    for (uint8_t i = 0; i < TILE_SLOTS_LEVEL; i++)
+    {
+        spares += !slots[i].valid || !slots[i].dirty;
+    }
+
+    // The tiles in use are the most recent ones, they are kept modified as long as the sensor stays in them
+    while (spares < TILE_SPARE_SLOTS)
+    {
+        tile_slot_t *oldest = NULL;
+        for (uint8_t i = 0; i < TILE_SLOTS_LEVEL; i++)
+        {
+            if (slots[i].valid && slots[i].dirty && (oldest == NULL || slots[i].use < oldest->use))
+            {
+                oldest = &slots[i];
+            }
+        }
+        _Write(oldest);
+        spares++;
+    }
+}
+
+static void _AddHit(tile_slot_t *slot, uint16_t cell)
+{
+    if (_GetHits(slot->cells, cell) < TILE_HITS_MAX)
+    {
+        slot->cells[cell >> 1] += 1 << ((cell & 1) * 4);
+        slot->dirty = true;
+    }
+}
+
+/* Count the waiting hits of the tiles now in RAM, the others keep waiting in order */
+static void _ReplayPending(void)
+{
+    uint8_t kept = 0;
+    uint16_t cell;
+
+    for (uint8_t i = 0; i < tile_pending_count; i++)
+    {
+        const tile_hit_t *hit = &tile_pending[i];
+        tile_slot_t *slot = _FindSlot(hit->level, _GetId(hit->level, hit->cell_x, hit->cell_y, &cell));
+        if (slot != NULL)
+        {
+            _AddHit(slot, cell);
+        }
+        else
+        {
+            tile_pending[kept++] = *hit;
+        }
+    }
+    tile_pending_count = kept;
+}
+
+static void _Load(tile_slot_t *slot, uint32_t id)
+{
+    // Never seen before unless stored
+    memset(slot->cells, 0, sizeof(slot->cells));
+    slot->id = id;
+    slot->valid = true;
+    slot->dirty = false;
+    _Merge(slot);
+}
+
+/* Add the stored hits to the slot */
+static void _Merge(tile_slot_t *slot)
+{
+    uint16_t length = 0;
+    const uint8_t *packed = STORE_Find(STORE_TYPE_TILE, slot->id, &length);
+
+    if (packed != NULL && _AddPacked(packed, length, slot->cells))
+    {
+        tile_loaded++;
+    }
+    slot->merge = false;
+}
+
+static void _Write(tile_slot_t *slot)
+{
+    if (slot->merge)
+    {
+        // The record replaces the stored tile, it must include its hits
+        _Merge(slot);
+    }
+
+    uint16_t length = _Pack(slot->cells, tile_pack_buf);
+
+    if (STORE_Write(STORE_TYPE_TILE, slot->id, tile_pack_buf, length))
+    {
+        tile_written++;
+    }
+    else
+    {
+        tile_failed++;
+    }
+    slot->dirty = false;
+}
+
+static uint16_t _Pack(const uint8_t *cells, uint8_t *packed)
+{
+    uint16_t in = 0;
+    uint16_t out = 0;
+
+    // Run-length encoding, a control byte is followed either by one repeated byte or by literal bytes
+    while (in < TILE_CELL_BYTES)
+    {
+        uint16_t run = 1;
+        while (in + run < TILE_CELL_BYTES && run < TILE_RUN_MAX && cells[in + run] == cells[in])
+        {
+            run++;
+        }
+
+        if (run >= TILE_RUN_MIN)
+        {
+            packed[out++] = 0x80 | (run - TILE_RUN_MIN);
+            packed[out++] = cells[in];
+            in += run;
+        }
+        else
+        {
+            // Literals until the next repeat long enough to be encoded
+            uint16_t start = in;
+            do
+            {
+                in++;
+            }
+            while (in < TILE_CELL_BYTES && in - start < TILE_LITERAL_MAX
+                    && !(in + 2 < TILE_CELL_BYTES && cells[in] == cells[in + 1] && cells[in] == cells[in + 2]));
+
+            packed[out++] = in - start - 1;
+            memcpy(&packed[out], &cells[start], in - start);
+            out += in - start;
+        }
+    }
+    return out;
+}
+
+static bool _AddPacked(const uint8_t *packed, uint16_t length, uint8_t *cells)
+{
+    uint16_t in = 0;
+    uint16_t out = 0;
+
+    while (in < length)
+    {
+        uint8_t control = packed[in++];
+        bool run = control & 0x80;
+        uint16_t count;
+        if (run)
+        {
+            count = (control & 0x7F) + TILE_RUN_MIN;
+            if (in >= length || out + count > TILE_CELL_BYTES)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            count = control + 1;
+            if (in + count > length || out + count > TILE_CELL_BYTES)
+            {
+                return false;
+            }
+        }
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            cells[out + i] = _AddCells(cells[out + i], packed[run ? in : in + i]);
+        }
+        in += run ? 1 : count;
+        out += count;
+    }
+    return out == TILE_CELL_BYTES;
+}
+
+/* Saturated sum of the two cells packed in a byte */
+static uint8_t _AddCells(uint8_t cells, uint8_t added)
+{
+    uint8_t low = (cells & 0x0F) + (added & 0x0F);
+    uint8_t high = (cells >> 4) + (added >> 4);
+
+    return (low < TILE_HITS_MAX ? low : TILE_HITS_MAX) | ((high < TILE_HITS_MAX ? high : TILE_HITS_MAX) << 4);
+}
+
+/* Read one cell of a packed tile without unpacking the others */
+static uint8_t _UnpackCell(const uint8_t *packed, uint16_t length, uint16_t cell)
+{
+    uint16_t in = 0;
+    uint16_t out = 0;
+    uint16_t target = cell >> 1;
+
+    while (in < length)
+    {
+        uint8_t control = packed[in++];
+        if (control & 0x80)
+        {
+            out += (control & 0x7F) + TILE_RUN_MIN;
+            if (in >= length)
+            {
+                return 0;
+            }
+            if (target < out)
+            {
+                return (packed[in] >> ((cell & 1) * 4)) & 0x0F;
+            }
+            in++;
+        }
+        else
+        {
+            uint16_t count = control + 1;
+            if (in + count > length)
+            {
+                return 0;
+            }
+            if (target < out + count)
+            {
+                return (packed[in + target - out] >> ((cell & 1) * 4)) & 0x0F;
+            }
+            in += count;
+            out += count;
+        }
+    }
+    return 0;
+}
+
+static uint8_t _GetHits(const uint8_t *cells, uint16_t cell)
+{
+    return (cells[cell >> 1] >> ((cell & 1) * 4)) & 0x0F;
+}
+
+static int32_t _FloorDiv(int32_t value, int32_t divisor)
+{
+    int32_t quotient = value / divisor;
+    return (value % divisor < 0) ? quotient - 1 : quotient;
+}
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h>
+#include "codec.h"
+#include "sim.h"
+
+#define SIM_CYCLES_PER_SAMPLE 24000 // 4 kHz at 96 MHz
+
+static sweep_frame_t sim_sweep;
+static sweep_frame_t decoded;
+static uint8_t buffer[CODEC_SWEEP_SIZE_MAX(SWEEP_SAMPLES_MAX)];
+
+static void test_codec_roundtrip(void);
+static void test_codec_constant_quality(void);
+static void test_codec_corrupted(void);
+static void test_codec_stream(void);
+
+int main()
+{
+    printf("START TESTS\n");
+
+    test_codec_roundtrip();
+    test_codec_constant_quality();
+    test_codec_corrupted();
+    test_codec_stream();
+}
+
+static void test_codec_roundtrip(void)
+{
+    printf("test_codec_roundtrip : ");
+
+    simulate_sweep(&sim_sweep, 42, SIM_CYCLES_PER_SAMPLE, false);
+    uint16_t length = CODEC_EncodeSweep(&sim_sweep, buffer, sizeof(buffer));
+    assert(length > 0);
+    assert(CODEC_DecodeSweep(buffer, length, &decoded) == length);
+
+    assert(decoded.index == sim_sweep.index);
+    assert(decoded.count == sim_sweep.count);
+    assert(decoded.start_timestamp == sim_sweep.start_timestamp);
+    assert(decoded.end_timestamp == sim_sweep.end_timestamp);
+    assert(!decoded.truncated);
+    for (uint16_t i = 0; i < sim_sweep.count; i++)
+    {
+        assert(decoded.samples[i].angle == sim_sweep.samples[i].angle);
+        assert(decoded.samples[i].distance == sim_sweep.samples[i].distance);
+        assert(decoded.samples[i].quality == sim_sweep.samples[i].quality);
+        // Timestamps are interpolated, samples are evenly spaced in the simulation
+        assert(decoded.samples[i].timestamp == sim_sweep.samples[i].timestamp);
+    }
+
+    // Buffer too small
+    assert(CODEC_EncodeSweep(&sim_sweep, buffer, length - 1) == 0);
+
+    printf("SUCCESS (%u bytes, %.2f bytes per sample)\n", length, (float) length / sim_sweep.count);
+}
+
+static void test_codec_constant_quality(void)
+{
+    printf("test_codec_constant_quality : ");
+
+    simulate_sweep(&sim_sweep, 7, SIM_CYCLES_PER_SAMPLE, true);
+    sim_sweep.truncated = true;
+    uint16_t length = CODEC_EncodeSweep(&sim_sweep, buffer, sizeof(buffer));
+    assert(length > 0);
+    assert(CODEC_DecodeSweep(buffer, length, &decoded) == length);
+    assert(decoded.truncated);
+    for (uint16_t i = 0; i < sim_sweep.count; i++)
+    {
+        assert(decoded.samples[i].quality == sim_sweep.samples[i].quality);
+    }
+
+    // Raw measurements are 5 bytes per sample
+    assert(length * 2 < sim_sweep.count * sizeof(rplidar_measurement_t));
+    printf("SUCCESS (%u bytes, %.2f bytes per sample)\n", length, (float) length / sim_sweep.count);
+}
+
+static void test_codec_corrupted(void)
+{
+    printf("test_codec_corrupted : ");
+
+    simulate_sweep(&sim_sweep, 3, SIM_CYCLES_PER_SAMPLE, false);
+    uint16_t length = CODEC_EncodeSweep(&sim_sweep, buffer, sizeof(buffer));
+    assert(length > 0);
+
+    // Incomplete
+    assert(CODEC_DecodeSweep(buffer, length - 1, &decoded) == 0);
+
+    // Any flipped bit is detected
+    for (uint16_t i = 0; i < length; i += 7)
+    {
+        buffer[i] ^= 0x10;
+        assert(CODEC_DecodeSweep(buffer, length, &decoded) == 0);
+        buffer[i] ^= 0x10;
+    }
+    assert(CODEC_DecodeSweep(buffer, length, &decoded) == length);
+
+    printf("SUCCESS\n");
+}
+
+static void test_codec_stream(void)
+{
+    static uint8_t stream[4 * sizeof(buffer)];
+    uint16_t length = 0;
+    printf("test_codec_stream : ");
+
+    // Sweeps are decoded back to back, the returned size gives the start of the next one
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        simulate_sweep(&sim_sweep, i, SIM_CYCLES_PER_SAMPLE, i % 2);
+        length += CODEC_EncodeSweep(&sim_sweep, &stream[length], sizeof(stream) - length);
+    }
+
+    uint16_t idx = 0;
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        uint16_t size = CODEC_DecodeSweep(&stream[idx], length - idx, &decoded);
+        assert(size > 0);
+        assert(decoded.index == i);
+        idx += size;
+    }
+    assert(idx == length);
+
+    printf("SUCCESS\n");
+}
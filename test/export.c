@@ -0,0 +1,203 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h>
+#include "export.h"
+#include "codec.h"
+#include "link.h"
+#include "sim.h"
+
+#define SIM_SWEEP_PERIOD 100 // ms
+#define SIM_DURATION 10000 // ms
+#define SIM_CYCLES_PER_SAMPLE (96000 * SIM_SWEEP_PERIOD / SIM_SAMPLES)
+#define SIM_LINK_FAST 1000 // Bytes per ms, USB full speed bulk transfers
+#define SIM_LINK_SLOW 11 // Bytes per ms, 115200 bauds UART
+#define SIM_RX_SIZE (4 * EXPORT_BUFFER_SIZE)
+
+static sweep_frame_t sim_sweep;
+static sweep_frame_t decoded;
+static bool sim_connected = true;
+static uint32_t sim_link_rate = SIM_LINK_FAST;
+static const uint8_t *sim_tx_data = NULL;
+static uint16_t sim_tx_length = 0;
+static uint32_t sim_tx_sent = 0;
+static uint8_t sim_rx[SIM_RX_SIZE];
+static uint16_t sim_rx_length = 0;
+static uint32_t sim_rx_sweeps = 0;
+static uint32_t sim_rx_bytes = 0;
+static uint32_t sim_rx_last_index = 0;
+static uint32_t sim_noise = 0; // Garbage bytes inserted before each transfer
+
+static void test_export_fast_link(void);
+static void test_export_slow_link(void);
+static void test_export_resync(void);
+static void test_export_disconnected(void);
+static void simulate(uint32_t duration);
+static void receive(const uint8_t *data, uint16_t length);
+static void reset(uint32_t link_rate, uint32_t noise);
+
+int main()
+{
+    printf("START TESTS\n");
+
+    test_export_fast_link();
+    test_export_slow_link();
+    test_export_resync();
+    test_export_disconnected();
+}
+
+bool LINK_Send(const uint8_t *data, uint16_t length)
+{
+    if (!sim_connected)
+    {
+        return false;
+    }
+    assert(sim_tx_data == NULL);
+    sim_tx_data = data;
+    sim_tx_length = length;
+    sim_tx_sent = 0;
+    return true;
+}
+
+static void test_export_fast_link(void)
+{
+    export_stats_t stats;
+    printf("test_export_fast_link : ");
+
+    reset(SIM_LINK_FAST, 0);
+    simulate(SIM_DURATION);
+    EXPORT_GetStats(&stats);
+
+    assert(stats.dropped == 0);
+    assert(stats.sweeps == SIM_DURATION / SIM_SWEEP_PERIOD);
+    assert(sim_rx_sweeps == stats.sweeps);
+    assert(sim_rx_bytes == stats.bytes);
+
+    printf("SUCCESS (%lu B/s for %u samples/s)\n", (unsigned long) (stats.bytes * 1000 / SIM_DURATION),
+           SIM_SAMPLES * 1000 / SIM_SWEEP_PERIOD);
+}
+
+static void test_export_slow_link(void)
+{
+    export_stats_t stats;
+    printf("test_export_slow_link : ");
+
+    // Sweeps are dropped instead of delaying the lidar, the ones received are intact and in order
+    reset(SIM_LINK_SLOW, 0);
+    simulate(SIM_DURATION);
+    EXPORT_GetStats(&stats);
+
+    assert(stats.dropped > 0);
+    // The last sweeps may still wait in the buffer being filled
+    assert(stats.sweeps + stats.dropped <= SIM_DURATION / SIM_SWEEP_PERIOD);
+    assert(stats.sweeps + stats.dropped + 1 >= SIM_DURATION / SIM_SWEEP_PERIOD);
+    assert(sim_rx_sweeps > 0);
+    assert(sim_rx_sweeps <= stats.sweeps);
+
+    printf("SUCCESS (%lu sent, %lu dropped)\n", (unsigned long) stats.sweeps, (unsigned long) stats.dropped);
+}
+
+static void test_export_resync(void)
+{
+    export_stats_t stats;
+    printf("test_export_resync : ");
+
+    // The host decoder skips the garbage and finds every sweep again
+    reset(SIM_LINK_FAST, 37);
+    simulate(SIM_DURATION);
+    EXPORT_GetStats(&stats);
+
+    assert(stats.dropped == 0);
+    assert(sim_rx_sweeps == stats.sweeps);
+
+    printf("SUCCESS\n");
+}
+
+static void test_export_disconnected(void)
+{
+    export_stats_t stats;
+    printf("test_export_disconnected : ");
+
+    reset(SIM_LINK_FAST, 0);
+    sim_connected = false;
+    simulate(SIM_DURATION);
+    EXPORT_GetStats(&stats);
+
+    assert(stats.sweeps == 0);
+    assert(stats.dropped == SIM_DURATION / SIM_SWEEP_PERIOD);
+    assert(sim_rx_sweeps == 0);
+
+    printf("SUCCESS\n");
+}
+
+static void simulate(uint32_t duration)
+{
+    // One more period to let the last transfer end
+    for (uint32_t tick = 1; tick <= duration + SIM_SWEEP_PERIOD; tick++)
+    {
+        if (sim_tx_data != NULL)
+        {
+            sim_tx_sent += sim_link_rate;
+            if (sim_tx_sent >= sim_tx_length)
+            {
+                // The buffer is read at the end of the transfer, it must not have been reused meanwhile
+                const uint8_t *data = sim_tx_data;
+                sim_tx_data = NULL;
+                receive(data, sim_tx_length);
+                LINK_TransmitComplete();
+            }
+        }
+
+        if (tick % SIM_SWEEP_PERIOD == 0 && tick <= duration)
+        {
+            simulate_sweep(&sim_sweep, tick / SIM_SWEEP_PERIOD, SIM_CYCLES_PER_SAMPLE, false);
+            EXPORT_AddSweep(&sim_sweep);
+        }
+        EXPORT_Update();
+    }
+}
+
+static void receive(const uint8_t *data, uint16_t length)
+{
+    bool found;
+
+    for (uint32_t i = 0; i < sim_noise; i++)
+    {
+        assert(sim_rx_length < SIM_RX_SIZE);
+        sim_rx[sim_rx_length++] = i % 3 == 0 ? CODEC_SYNC : random_next();
+    }
+    assert(sim_rx_length + length <= SIM_RX_SIZE);
+    memcpy(&sim_rx[sim_rx_length], data, length);
+    sim_rx_length += length;
+    sim_rx_bytes += length;
+
+    do
+    {
+        uint16_t size = CODEC_DecodeStream(sim_rx, sim_rx_length, &decoded, &found);
+        if (found)
+        {
+            assert(decoded.index > sim_rx_last_index);
+            assert(decoded.count == SIM_SAMPLES);
+            sim_rx_last_index = decoded.index;
+            sim_rx_sweeps++;
+        }
+        memmove(sim_rx, &sim_rx[size], sim_rx_length - size);
+        sim_rx_length -= size;
+    }
+    while (found);
+}
+
+static void reset(uint32_t link_rate, uint32_t noise)
+{
+    EXPORT_Enable(false);
+    EXPORT_Enable(true);
+    LINK_TransmitComplete();
+    sim_connected = true;
+    sim_link_rate = link_rate;
+    sim_tx_data = NULL;
+    sim_rx_length = 0;
+    sim_rx_sweeps = 0;
+    sim_rx_bytes = 0;
+    sim_rx_last_index = 0;
+    sim_noise = noise;
+}
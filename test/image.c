@@ -0,0 +1,124 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h>
+#include "image.h"
+
+#define TEST_IMAGE_MAX (64 * 64 * 3)
+
+extern const image_t logo;
+extern const image_t cross;
+extern const image_t volume;
+
+static const uint8_t test_palette[] = {0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00};
+static const uint8_t test_data[] = {IMAGE_TOKEN_RUN | 4, 1, 2, 0, 2, 1, IMAGE_TOKEN_RUN | 1, 0};
+static const uint8_t test_expected[] = {1, 1, 1, 1, 1, 0, 2, 1, 0, 0};
+static const image_t test_image = {.width = 5, .height = 2, .colors = 3, .palette = test_palette, .data = test_data,
+        .size = sizeof(test_data)};
+
+static uint8_t whole[TEST_IMAGE_MAX];
+static uint8_t chunked[TEST_IMAGE_MAX];
+
+static void test_image_tokens(void);
+static void test_image_chunks(void);
+static void test_image_invalid(void);
+static uint32_t decode(const image_t *image, uint8_t *buffer, uint16_t chunk);
+
+int main()
+{
+    printf("START TESTS\n");
+
+    test_image_tokens();
+    test_image_chunks();
+    test_image_invalid();
+}
+
+static void test_image_tokens(void)
+{
+    printf("test_image_tokens : ");
+
+    // A run of 5 pixels, 3 literal pixels then a run of 2 pixels
+    assert(decode(&test_image, whole, 3) == sizeof(test_expected) * 3);
+    for (uint8_t i = 0; i < sizeof(test_expected); i++)
+    {
+        assert(memcmp(&whole[i * 3], &test_palette[test_expected[i] * 3], 3) == 0);
+    }
+
+    printf("SUCCESS\n");
+}
+
+static void test_image_chunks(void)
+{
+    static const image_t *images[] = {&logo, &cross, &volume};
+    static const uint16_t chunks[] = {3, 4, 20, 381, 999, TEST_IMAGE_MAX};
+    printf("test_image_chunks : ");
+
+    for (uint8_t i = 0; i < sizeof(images) / sizeof(images[0]); i++)
+    {
+        uint32_t size = images[i]->width * images[i]->height * 3;
+        assert(size <= TEST_IMAGE_MAX);
+        assert(decode(images[i], whole, TEST_IMAGE_MAX) == size);
+
+        // Chunks that split the tokens anywhere give the same pixels
+        for (uint8_t j = 0; j < sizeof(chunks) / sizeof(chunks[0]); j++)
+        {
+            memset(chunked, 0, sizeof(chunked));
+            assert(decode(images[i], chunked, chunks[j]) == size);
+            assert(memcmp(whole, chunked, size) == 0);
+        }
+    }
+
+    printf("SUCCESS\n");
+}
+
+static void test_image_invalid(void)
+{
+    image_decoder_t decoder;
+    uint8_t buffer[30];
+    printf("test_image_invalid : ");
+
+    // Palette index out of range in a run and in a literal token
+    static const uint8_t bad_run[] = {IMAGE_TOKEN_RUN | 3, 3};
+    static const uint8_t bad_literal[] = {2, 0, 1, 7};
+    image_t image = test_image;
+    image.data = bad_run;
+    image.size = sizeof(bad_run);
+    IMAGE_Start(&decoder, &image);
+    assert(IMAGE_Decode(&decoder, buffer, sizeof(buffer)) == 0);
+    image.data = bad_literal;
+    image.size = sizeof(bad_literal);
+    IMAGE_Start(&decoder, &image);
+    assert(IMAGE_Decode(&decoder, buffer, sizeof(buffer)) == 0);
+    assert(IMAGE_Decode(&decoder, buffer, sizeof(buffer)) == 0);
+
+    // Truncated literal token stops at the end of the data
+    image.data = test_data;
+    image.size = 4;
+    IMAGE_Start(&decoder, &image);
+    assert(IMAGE_Decode(&decoder, buffer, 15) == 15);
+    assert(IMAGE_Decode(&decoder, buffer, sizeof(buffer)) == 0);
+
+    // A buffer smaller than a pixel
+    IMAGE_Start(&decoder, &test_image);
+    assert(IMAGE_Decode(&decoder, buffer, 2) == 0);
+
+    printf("SUCCESS\n");
+}
+
+/* Decode a whole image in chunks, return its size in bytes */
+static uint32_t decode(const image_t *image, uint8_t *buffer, uint16_t chunk)
+{
+    image_decoder_t decoder;
+    uint32_t size = 0;
+    uint16_t written;
+
+    IMAGE_Start(&decoder, image);
+    chunk -= chunk % 3;
+    while ((written = IMAGE_Decode(&decoder, &buffer[size], chunk)) > 0)
+    {
+        assert(written % 3 == 0);
+        size += written;
+        assert(size <= TEST_IMAGE_MAX);
+    }
+    return size;
+}
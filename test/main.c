@@ -16,10 +16,12 @@ typedef enum
     cb_RPLIDAR_OnDenseMeasurements
 } callback_type_t;
 
-UART_HandleTypeDef huart1;
+UART_HandleTypeDef huart1 = {.Init.BaudRate = 460800, .gState = HAL_UART_STATE_READY};
 
 extern uint8_t *buf;
 static callback_type_t cb_type = None;
+static uint32_t cb_timestamps[2];
+static uint8_t cb_timestamps_nb = 0;
 
 static void test_device_info_request(void);
 static void test_health_request(void);
@@ -27,6 +29,9 @@ static void test_samplerate_request(void);
 static void test_configuration_request(void);
 static void test_scan_request(void);
 static void test_scan_express_request(void);
+static void test_scan_express_bad_checksum(void);
+static void test_measurement_timestamps(void);
+static void set_capsule_checksum(uint8_t *capsule);
 
 int main()
 {
@@ -39,6 +44,8 @@ int main()
     test_configuration_request();
     test_scan_request();
     test_scan_express_request();
+    test_scan_express_bad_checksum();
+    test_measurement_timestamps();
 }
 
 static void test_device_info_request(void)
@@ -226,6 +233,10 @@ void RPLIDAR_OnSingleMeasurement(rplidar_measurement_t *measurement)
     assert(measurement->check == 1);
     assert(measurement->angle == ANGLE);
     assert(measurement->distance == DISTANCE);
+    if (cb_timestamps_nb < 2)
+    {
+        cb_timestamps[cb_timestamps_nb++] = RPLIDAR_GetMeasurementTimestamp();
+    }
     cb_type = cb_RPLIDAR_OnSingleMeasurement;
 }
 
@@ -258,11 +269,109 @@ static void test_scan_express_request(void)
         buf[head++] = (DISTANCE_EXPR + i) & 0xFF;
         buf[head++] = ((DISTANCE_EXPR + i) & 0xFF00) >> 8;
     }
+    set_capsule_checksum(&buf[7]);
     HAL_UARTEx_RxEventCallback(&huart1, head);
     assert(cb_type == cb_RPLIDAR_OnDenseMeasurements);
     printf("SUCCESS\n");
 }
 
+static void test_scan_express_bad_checksum(void)
+{
+    uint16_t head = 0;
+    rplidar_stats_t stats_before;
+    rplidar_stats_t stats_after;
+    printf("test_scan_express_bad_checksum : ");
+    cb_type = None;
+
+    RPLIDAR_StartScanExpress(NULL, 0, 0);
+    RPLIDAR_GetStats(&stats_before);
+
+    // Send express scan descriptor
+    buf[head++] = 0xA5;
+    buf[head++] = 0x5A;
+    buf[head++] = 0x54;
+    buf[head++] = 0x00;
+    buf[head++] = 0x00;
+    buf[head++] = 0x40;
+    buf[head++] = 0x85;
+    // First capsule has a corrupted distance, second one has wrong sync values
+    for (uint8_t capsule = 0; capsule < 2; capsule++)
+    {
+        uint16_t start = head;
+        buf[head++] = SYNC_FLAG_EXPR & 0xF0;
+        buf[head++] = (SYNC_FLAG_EXPR & 0x0F) << 4;
+        buf[head++] = ANGLE_EXPR & 0xFF;
+        buf[head++] = ((ANGLE_EXPR & 0x7F00) >> 8) | (0x01 << 7);
+        for (uint8_t i = 0; i < 40; i++)
+        {
+            buf[head++] = (DISTANCE_EXPR + i) & 0xFF;
+            buf[head++] = ((DISTANCE_EXPR + i) & 0xFF00) >> 8;
+        }
+        set_capsule_checksum(&buf[start]);
+        if (capsule == 0)
+        {
+            buf[start + 10] ^= 0x01;
+        }
+        else
+        {
+            buf[start] = (buf[start] & 0x0F) | 0xB0;
+        }
+    }
+    HAL_UARTEx_RxEventCallback(&huart1, head);
+    RPLIDAR_GetStats(&stats_after);
+    assert(cb_type == None);
+    assert(stats_after.capsule_errors - stats_before.capsule_errors == 2);
+    printf("SUCCESS\n");
+}
+
+static void test_measurement_timestamps(void)
+{
+    uint16_t head = 0;
+    // 460800 bauds at 96 MHz, 10 bits per byte
+    const uint32_t cycles_per_byte = (96000000 / 460800) * 10;
+    printf("test_measurement_timestamps : ");
+    cb_type = None;
+    cb_timestamps_nb = 0;
+
+    RPLIDAR_StartScan(NULL, 0, 0);
+
+    // Send scan descriptor
+    buf[head++] = 0xA5;
+    buf[head++] = 0x5A;
+    buf[head++] = 0x05;
+    buf[head++] = 0x00;
+    buf[head++] = 0x00;
+    buf[head++] = 0x40;
+    buf[head++] = 0x81;
+    // Two measurements in the same batch
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        buf[head++] = ((QUALITY << 2) & 0xFC) | 0x01;
+        buf[head++] = (((ANGLE & 0xFF) << 1) & 0xFE) | 1;
+        buf[head++] = (ANGLE & 0xFF80) >> 7;
+        buf[head++] = DISTANCE & 0xFF;
+        buf[head++] = (DISTANCE & 0xFF00) >> 8;
+    }
+    mock_dwt.CYCCNT = 1000000;
+    HAL_UARTEx_RxEventCallback(&huart1, head);
+    assert(cb_timestamps_nb == 2);
+    // Idle event is raised one byte after the last byte of the batch
+    assert(cb_timestamps[1] == 1000000 - cycles_per_byte);
+    assert(cb_timestamps[0] == cb_timestamps[1] - 5 * cycles_per_byte);
+    printf("SUCCESS\n");
+}
+
+static void set_capsule_checksum(uint8_t *capsule)
+{
+    uint8_t checksum = 0;
+    for (uint8_t i = 2; i < 84; i++)
+    {
+        checksum ^= capsule[i];
+    }
+    capsule[0] = (capsule[0] & 0xF0) | (checksum & 0x0F);
+    capsule[1] = (capsule[1] & 0xF0) | (checksum >> 4);
+}
+
 void RPLIDAR_OnDenseMeasurements(rplidar_dense_measurements_t *measurement)
 {
     assert(measurement->sync1 == 0xA);
@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include "match.h"
+#include "sim.h"
+
+#define SIM_SWEEPS 60
+#define SIM_NOISE_MM 10
+#define SIM_STEP_MM 25.0f
+#define SIM_STEP_RAD 0.008f
+#define SIM_CPU_HZ 96000000
+#define SIM_SAMPLE_RATE 16000 // samples/s, fastest scan mode
+#define SIM_SAMPLE_BUF_SIZE 1024 // Samples buffered by the map while a sweep is matched
+#define SIM_REVOLUTION_HZ 10
+#define SIM_CPU_SHARE 10 // %, of a revolution used by the tracking
+
+typedef struct
+{
+    float x1, y1, x2, y2;
+} wall_t;
+
+// L-shaped room with a pillar, in mm
+static const wall_t sim_walls[] = {
+        {-2000, -1500, 4000, -1500},
+        {4000, -1500, 4000, 1000},
+        {4000, 1000, 1000, 1000},
+        {1000, 1000, 1000, 3000},
+        {1000, 3000, -2000, 3000},
+        {-2000, 3000, -2000, -1500},
+        {2000, 0, 2300, 0},
+        {2300, 0, 2300, 300},
+        {2300, 300, 2000, 300},
+        {2000, 300, 2000, 0}};
+
+static sweep_frame_t sim_sweep;
+
+static void test_match_static(void);
+static void test_match_trajectory(void);
+static void raycast_sweep(const match_pose_t *pose, uint16_t index);
+static float raycast(float x, float y, float dx, float dy);
+static float noise(void);
+static float angle_diff(float a, float b);
+
+int main()
+{
+    printf("START TESTS\n");
+
+    test_match_static();
+    test_match_trajectory();
+}
+
+static void test_match_static(void)
+{
+    match_pose_t pose = {0};
+    match_pose_t estimate;
+    printf("test_match_static : ");
+
+    MATCH_Reset();
+    for (uint16_t i = 0; i < 10; i++)
+    {
+        raycast_sweep(&pose, i);
+        assert(MATCH_AddSweep(&sim_sweep));
+    }
+    MATCH_GetPose(&estimate);
+    assert(fabsf(estimate.x) < 10 && fabsf(estimate.y) < 10 && fabsf(estimate.theta) < 0.005f);
+    printf("SUCCESS\n");
+}
+
+static void test_match_trajectory(void)
+{
+    match_pose_t pose = {0};
+    match_pose_t estimate;
+    match_stats_t stats;
+    float error_max = 0, angle_error_max = 0;
+    uint32_t searches_max = 0, searches_total = 0;
+    printf("test_match_trajectory : ");
+
+    MATCH_Reset();
+    for (uint16_t i = 0; i < SIM_SWEEPS; i++)
+    {
+        // Walk along the room while slowly turning
+        pose.x = i * SIM_STEP_MM;
+        pose.y = 400.0f * sinf(i * 0.05f);
+        pose.theta = i * SIM_STEP_RAD;
+        raycast_sweep(&pose, i);
+        assert(MATCH_AddSweep(&sim_sweep));
+        MATCH_GetStats(&stats);
+        searches_total += stats.searches;
+        searches_max = stats.searches > searches_max ? stats.searches : searches_max;
+
+        MATCH_GetPose(&estimate);
+        float error = hypotf(estimate.x - pose.x, estimate.y - pose.y);
+        float angle_error = fabsf(angle_diff(estimate.theta, pose.theta));
+        error_max = error > error_max ? error : error_max;
+        angle_error_max = angle_error > angle_error_max ? angle_error : angle_error_max;
+    }
+    MATCH_GetStats(&stats);
+
+    // Drift over 1.5 m of walk
+    assert(error_max < 50.0f);
+    assert(angle_error_max < 1.0f * M_PI / 180);
+    assert(stats.failed == 0);
+    assert(stats.keyframes > 1);
+
+    // The cost is counted in correspondence searches, not in host time. The worst case match must not overflow the
+    // map sample buffer and a tracked sweep must leave the F411 for the rest
+    assert((uint64_t) MATCH_ITERATIONS_MAX * MATCH_POINTS_MAX * MATCH_CYCLES_PER_SEARCH * SIM_SAMPLE_RATE
+            < (uint64_t) SIM_SAMPLE_BUF_SIZE * SIM_CPU_HZ);
+    assert(searches_max < MATCH_ITERATIONS_MAX * MATCH_POINTS_MAX);
+    assert((uint64_t) searches_total * MATCH_CYCLES_PER_SEARCH * SIM_REVOLUTION_HZ * 100
+            < (uint64_t) SIM_SWEEPS * SIM_CPU_HZ * SIM_CPU_SHARE);
+    printf("SUCCESS (error %.1f mm %.2f deg, %lu keyframes, %lu searches avg %lu max, %lu us max on target)\n",
+           error_max, angle_error_max * 180 / M_PI, (unsigned long) stats.keyframes,
+           (unsigned long) (searches_total / SIM_SWEEPS), (unsigned long) searches_max,
+           (unsigned long) ((uint64_t) searches_max * MATCH_CYCLES_PER_SEARCH * 1000000 / SIM_CPU_HZ));
+}
+
+/* Raycast the room from a pose, each sweep starts at a slightly different angle like the real sensor */
+static void raycast_sweep(const match_pose_t *pose, uint16_t index)
+{
+    float offset = fmodf(index * 0.17f, 0.5f);
+
+    sim_sweep.index = index;
+    sim_sweep.count = 0;
+    for (uint16_t i = 0; i < SIM_SAMPLES; i++)
+    {
+        float angle = i * (360.0f / SIM_SAMPLES) + offset;
+        float a = angle * (float) M_PI / 180.0f;
+        float sx = sinf(a), sy = -cosf(a);
+        float dx = cosf(pose->theta) * sx - sinf(pose->theta) * sy;
+        float dy = sinf(pose->theta) * sx + cosf(pose->theta) * sy;
+        float distance = raycast(pose->x, pose->y, dx, dy);
+        if (distance <= 0)
+        {
+            continue;
+        }
+        sweep_sample_t *sample = &sim_sweep.samples[sim_sweep.count++];
+        sample->angle = lroundf(angle * 64);
+        sample->distance = lroundf((distance + noise()) * 4);
+        sample->quality = 47;
+        sample->timestamp = i;
+    }
+}
+
+static float raycast(float x, float y, float dx, float dy)
+{
+    float nearest = -1;
+    for (uint8_t i = 0; i < sizeof(sim_walls) / sizeof(sim_walls[0]); i++)
+    {
+        const wall_t *w = &sim_walls[i];
+        float ex = w->x2 - w->x1, ey = w->y2 - w->y1;
+        float det = dx * ey - dy * ex;
+        if (fabsf(det) < 1e-6f)
+        {
+            continue;
+        }
+        float t = ((w->x1 - x) * ey - (w->y1 - y) * ex) / det;
+        float u = ((w->x1 - x) * dy - (w->y1 - y) * dx) / det;
+        if (t > 0 && u >= 0 && u <= 1 && (nearest < 0 || t < nearest))
+        {
+            nearest = t;
+        }
+    }
+    return nearest;
+}
+
+static float noise(void)
+{
+    return ((int32_t) (random_next() % (2 * SIM_NOISE_MM + 1))) - SIM_NOISE_MM;
+}
+
+static float angle_diff(float a, float b)
+{
+    float d = fmodf(a - b, 2 * (float) M_PI);
+    if (d > M_PI)
+    {
+        d -= 2 * M_PI;
+    }
+    else if (d < -M_PI)
+    {
+        d += 2 * M_PI;
+    }
+    return d;
+}
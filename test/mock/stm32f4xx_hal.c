@@ -2,6 +2,9 @@
 #include "stm32f4xx_hal.h"
 
 uint8_t *buf;
+DWT_Type mock_dwt;
+CoreDebug_Type mock_core_debug;
+uint32_t SystemCoreClock = 96000000;
 
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
 {
@@ -21,10 +24,17 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
 
 uint32_t HAL_GetTick(void)
 {
-    return 1234;
+    // Advance time on each call so blocking requests can time out
+    static uint32_t tick = 1234;
+    return tick++;
 }
 
 void HAL_Delay(uint32_t Delay)
 {
     return;
 }
+
+uint32_t HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart)
+{
+    return HAL_UART_RXEVENT_IDLE;
+}
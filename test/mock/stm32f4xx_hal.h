@@ -13,16 +13,51 @@ typedef enum
 
 #define DMA_IT_HT 0
 #define __HAL_DMA_DISABLE_IT(hdma, IT) ;
+#define __HAL_DMA_GET_COUNTER(hdma) 0U
+
+#define HAL_UART_RXEVENT_TC 0x00U
+#define HAL_UART_RXEVENT_HT 0x01U
+#define HAL_UART_RXEVENT_IDLE 0x02U
+
+#define HAL_UART_STATE_READY 0x20U
+
+typedef struct
+{
+    uint32_t BaudRate;
+} UART_InitTypeDef;
 
 typedef struct
 {
     uint32_t Instance;
+    UART_InitTypeDef Init;
+    uint32_t gState;
 } UART_HandleTypeDef;
 
+typedef struct
+{
+    uint32_t CTRL;
+    uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    uint32_t DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk 0x1U
+#define CoreDebug_DEMCR_TRCENA_Msk (1U << 24)
+
+extern DWT_Type mock_dwt;
+extern CoreDebug_Type mock_core_debug;
+extern uint32_t SystemCoreClock;
+#define DWT (&mock_dwt)
+#define CoreDebug (&mock_core_debug)
+
 HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart);
 void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t head);
+uint32_t HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart);
 uint32_t HAL_GetTick(void);
 void HAL_Delay(uint32_t Delay);
 
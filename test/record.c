@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "record.h"
+#include "store.h"
+#include "link.h"
+#include "sim.h"
+
+#define SIM_BATCH_MAX 200 // Bytes per idle event
+#define SIM_CYCLES_PER_BYTE 2083 // 460800 bauds at 96 MHz
+#define SIM_CYCLES_PER_MS 96000
+#define SIM_RECORDS 4
+
+typedef struct
+{
+    uint32_t id;
+    uint16_t length;
+    uint8_t data[RECORD_BUFFER_SIZE];
+} sim_record_t;
+
+static sim_record_t sim_records[SIM_RECORDS];
+static uint8_t sim_dump[sizeof(record_header_t) + RECORD_BUFFER_SIZE];
+static uint32_t sim_dump_length = 0;
+static uint8_t sim_batch[SIM_BATCH_MAX];
+static uint32_t sim_stream = 0; // Position in the simulated lidar byte stream
+
+static void test_record_overwrite(void);
+static void test_record_large_batch(void);
+static void test_record_send(void);
+static void feed(uint32_t bytes);
+static uint32_t check_dump(const uint8_t *dump, uint32_t length);
+static uint8_t stream_byte(uint32_t position);
+
+int main()
+{
+    printf("START TESTS\n");
+
+    test_record_overwrite();
+    test_record_large_batch();
+    test_record_send();
+}
+
+bool STORE_Write(uint16_t type, uint32_t id, const void *data, uint16_t length)
+{
+    assert(type == STORE_TYPE_RECORD && id < SIM_RECORDS);
+    sim_records[id].id = id;
+    sim_records[id].length = length;
+    memcpy(sim_records[id].data, data, length);
+    return true;
+}
+
+bool STORE_Reserve(uint32_t length, uint16_t count)
+{
+    (void) length;
+    (void) count;
+    return true;
+}
+
+bool STORE_Delete(uint16_t type, uint32_t id)
+{
+    assert(type == STORE_TYPE_RECORD && id == STORE_ID_ALL);
+    memset(sim_records, 0, sizeof(sim_records));
+    return true;
+}
+
+const void* STORE_Find(uint16_t type, uint32_t id, uint16_t *length)
+{
+    (void) type;
+    if (id >= SIM_RECORDS || sim_records[id].length == 0)
+    {
+        return NULL;
+    }
+    *length = sim_records[id].length;
+    return sim_records[id].data;
+}
+
+bool LINK_Send(const uint8_t *data, uint16_t length)
+{
+    assert(sim_dump_length + length <= sizeof(sim_dump));
+    memcpy(&sim_dump[sim_dump_length], data, length);
+    sim_dump_length += length;
+    LINK_TransmitComplete();
+    return true;
+}
+
+static void test_record_overwrite(void)
+{
+    record_stats_t stats;
+    printf("test_record_overwrite : ");
+
+    // Several rings worth of bytes, only the newest entries are kept
+    feed(5 * RECORD_BUFFER_SIZE);
+    RECORD_GetStats(&stats);
+    assert(stats.overwritten > 0);
+    assert(stats.used <= RECORD_BUFFER_SIZE);
+    // The oldest entry is received before the span starts
+    assert(stats.span > 0);
+    uint32_t payload = stats.used - stats.entries * RECORD_ENTRY_HEADER_SIZE;
+    assert(stats.span < payload * SIM_CYCLES_PER_BYTE);
+    uint32_t span = stats.span;
+    assert(RECORD_Dump());
+
+    // Rebuild the dump from the saved records like the host does
+    uint32_t length = 0;
+    for (uint32_t id = 0; id < SIM_RECORDS; id++)
+    {
+        memcpy(&sim_dump[length], sim_records[id].data, sim_records[id].length);
+        length += sim_records[id].length;
+    }
+    assert(check_dump(sim_dump, length) == stats.entries);
+
+    // Recording restarts from an empty ring
+    RECORD_GetStats(&stats);
+    assert(stats.entries == 0 && stats.used == 0 && stats.dumps == 1 && stats.span == 0);
+
+    printf("SUCCESS (%lu ms at full line rate)\n", (unsigned long) span / SIM_CYCLES_PER_MS);
+}
+
+static void test_record_large_batch(void)
+{
+    printf("test_record_large_batch : ");
+
+    // A batch larger than the ring keeps its end
+    for (uint32_t i = 0; i < sizeof(sim_batch); i++)
+    {
+        sim_batch[i] = stream_byte(sim_stream + i);
+    }
+    RECORD_AddData(sim_batch, sizeof(sim_batch));
+    sim_stream += sizeof(sim_batch);
+    static uint8_t large[RECORD_BUFFER_SIZE + 100];
+    for (uint32_t i = 0; i < sizeof(large); i++)
+    {
+        large[i] = stream_byte(sim_stream + i);
+    }
+    RECORD_AddData(large, sizeof(large));
+    sim_stream += sizeof(large);
+    assert(RECORD_Dump());
+
+    uint32_t length = 0;
+    for (uint32_t id = 0; id < SIM_RECORDS; id++)
+    {
+        memcpy(&sim_dump[length], sim_records[id].data, sim_records[id].length);
+        length += sim_records[id].length;
+    }
+    assert(check_dump(sim_dump, length) == 1);
+
+    printf("SUCCESS\n");
+}
+
+static void test_record_send(void)
+{
+    printf("test_record_send : ");
+
+    feed(3 * RECORD_BUFFER_SIZE / 2);
+    assert(RECORD_Dump());
+    assert(RECORD_Send());
+    sim_dump_length = 0;
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        RECORD_Update();
+    }
+    assert(check_dump(sim_dump, sim_dump_length) > 0);
+
+    printf("SUCCESS (%lu bytes)\n", (unsigned long) sim_dump_length);
+}
+
+static void feed(uint32_t bytes)
+{
+    uint32_t end = sim_stream + bytes;
+
+    while (sim_stream < end)
+    {
+        uint16_t length = 1 + random_next() % SIM_BATCH_MAX;
+        for (uint16_t i = 0; i < length; i++)
+        {
+            sim_batch[i] = stream_byte(sim_stream + i);
+        }
+        mock_dwt.CYCCNT += length * SIM_CYCLES_PER_BYTE;
+        RECORD_AddData(sim_batch, length);
+        sim_stream += length;
+    }
+}
+
+/* Reference parser of the dump, return the number of entries */
+static uint32_t check_dump(const uint8_t *dump, uint32_t length)
+{
+    record_header_t header;
+    uint32_t idx = sizeof(header);
+    uint32_t entries = 0;
+    uint32_t timestamp = 0;
+
+    assert(length >= sizeof(header));
+    memcpy(&header, dump, sizeof(header));
+    assert(header.magic == RECORD_MAGIC && header.version == RECORD_VERSION);
+    assert(header.cycles_per_second == SystemCoreClock);
+    assert(sizeof(header) + header.length == length);
+
+    // Entries are contiguous and end with the newest byte of the stream
+    uint32_t position = sim_stream - (header.length - header.entries * RECORD_ENTRY_HEADER_SIZE);
+
+    while (idx < length)
+    {
+        uint32_t entry_timestamp;
+        uint16_t entry_length;
+        memcpy(&entry_timestamp, &dump[idx], sizeof(entry_timestamp));
+        memcpy(&entry_length, &dump[idx + 4], sizeof(entry_length));
+        idx += RECORD_ENTRY_HEADER_SIZE;
+        assert(entry_length > 0 && idx + entry_length <= length);
+        assert(entries == 0 || entry_timestamp >= timestamp);
+
+        for (uint16_t i = 0; i < entry_length; i++)
+        {
+            assert(dump[idx + i] == stream_byte(position + i));
+        }
+        position += entry_length;
+        timestamp = entry_timestamp;
+        idx += entry_length;
+        entries++;
+    }
+
+    assert(entries == header.entries);
+    assert(position == sim_stream);
+    return entries;
+}
+
+static uint8_t stream_byte(uint32_t position)
+{
+    // Pseudo random but reproducible from the position
+    uint32_t value = position * 2654435761u;
+    return value >> 24;
+}
@@ -0,0 +1,41 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "sim.h"
+
+#define SIM_TIMESTAMP_START 0xFFF00000 // Close to the wrap of the cycle counter
+
+static uint32_t sim_random = 1;
+
+void simulate_sweep(sweep_frame_t *sweep, uint32_t index, uint32_t cycles_per_sample, bool constant_quality)
+{
+    uint16_t distance = 2000 * 4;
+
+    sweep->index = index;
+    sweep->count = SIM_SAMPLES;
+    sweep->truncated = false;
+    sweep->decimated = 0;
+    sweep->start_timestamp = SIM_TIMESTAMP_START + index * SIM_SAMPLES * cycles_per_sample;
+    for (uint16_t i = 0; i < SIM_SAMPLES; i++)
+    {
+        sweep_sample_t *sample = &sweep->samples[i];
+        sample->timestamp = sweep->start_timestamp + i * cycles_per_sample;
+        sample->angle = (i * 360 * 64) / SIM_SAMPLES + random_next() % 8;
+        if (random_next() % 50 == 0)
+        {
+            distance = 500 * 4 + random_next() % (8000 * 4);
+        }
+        else
+        {
+            distance += (int16_t) (random_next() % 41) - 20;
+        }
+        sample->distance = distance;
+        sample->quality = constant_quality ? 47 : 40 + random_next() % 24;
+    }
+    sweep->end_timestamp = sweep->samples[SIM_SAMPLES - 1].timestamp;
+}
+
+uint32_t random_next(void)
+{
+    sim_random = sim_random * 1103515245 + 12345;
+    return (sim_random >> 16) & 0x7FFF;
+}
@@ -0,0 +1,16 @@
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sweep.h"
+
+#define SIM_SAMPLES 720 // Express scan, 7200 samples/s at 10 Hz
+
+/* Fill a sweep with a noisy random walk of the distance and a jump now and then, like a cluttered room */
+void simulate_sweep(sweep_frame_t *sweep, uint32_t index, uint32_t cycles_per_sample, bool constant_quality);
+
+/* Reproducible pseudo random number, from 0 to 0x7FFF */
+uint32_t random_next(void);
+
+#endif /* SIM_H_ */
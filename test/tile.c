@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include "tile.h"
+#include "store.h"
+#include "sim.h"
+
+#define SIM_RECORDS 256
+#define SIM_RECORD_SIZE 600 // Larger than a compressed tile
+#define SIM_REVOLUTIONS 600
+#define SIM_STEP_MM 30 // Walking speed at 10 Hz, 0.3 m/s
+#define SIM_SAMPLES_NEAR 400 // Per revolution, counted in both levels
+#define SIM_SAMPLES_FAR 400 // Per revolution, only counted in the coarse level
+#define SIM_FINE_RANGE 1400 // mm
+#define SIM_FINE_LEVEL_RANGE 1500 // mm, farther samples are only counted in the coarse level
+#define SIM_FAR_RANGE 11000 // mm
+#define SIM_GRID_ORIGIN (-4000) // mm, fine cells checked from here on both axes
+#define SIM_GRID_SIZE 160 // Fine cells per side, 16 m
+
+typedef struct
+{
+    uint32_t id;
+    uint16_t length;
+    uint8_t data[SIM_RECORD_SIZE];
+} sim_record_t;
+
+static sim_record_t sim_records[SIM_RECORDS];
+static uint16_t sim_record_count = 0;
+static uint16_t sim_grid[SIM_GRID_SIZE][SIM_GRID_SIZE]; // Expected fine hits
+
+static void test_tile_walk(void);
+static void add_sample(int32_t x, int32_t y, uint16_t distance);
+
+int main()
+{
+    printf("START TESTS\n");
+
+    test_tile_walk();
+}
+
+bool STORE_Write(uint16_t type, uint32_t id, const void *data, uint16_t length)
+{
+    assert(type == STORE_TYPE_TILE && length <= SIM_RECORD_SIZE);
+    for (uint16_t i = 0; i < sim_record_count; i++)
+    {
+        if (sim_records[i].id == id)
+        {
+            sim_records[i].length = length;
+            memcpy(sim_records[i].data, data, length);
+            return true;
+        }
+    }
+    assert(sim_record_count < SIM_RECORDS);
+    sim_records[sim_record_count].id = id;
+    sim_records[sim_record_count].length = length;
+    memcpy(sim_records[sim_record_count].data, data, length);
+    sim_record_count++;
+    return true;
+}
+
+bool STORE_Delete(uint16_t type, uint32_t id)
+{
+    assert(type == STORE_TYPE_TILE && id == STORE_ID_ALL);
+    sim_record_count = 0;
+    return true;
+}
+
+const void* STORE_Find(uint16_t type, uint32_t id, uint16_t *length)
+{
+    assert(type == STORE_TYPE_TILE);
+    for (uint16_t i = 0; i < sim_record_count; i++)
+    {
+        if (sim_records[i].id == id)
+        {
+            *length = sim_records[i].length;
+            return sim_records[i].data;
+        }
+    }
+    return NULL;
+}
+
+static void test_tile_walk(void)
+{
+    tile_stats_t stats;
+    uint8_t hits[SIM_GRID_SIZE];
+    printf("test_tile_walk : ");
+
+    TILE_Reset();
+    memset(sim_grid, 0, sizeof(sim_grid));
+
+    // Diagonal walk of 13 m and back part of the way, the fine tiles are 3.2 m wide and the coarse ones 25.6 m so
+    // both levels change tiles and come back to the tiles already written
+    int32_t x = -2000;
+    int32_t y = -1000;
+    for (uint16_t revolution = 0; revolution < SIM_REVOLUTIONS; revolution++)
+    {
+        for (uint16_t i = 0; i < SIM_SAMPLES_NEAR + SIM_SAMPLES_FAR; i++)
+        {
+            float angle = 2.0f * (float) M_PI * i / (SIM_SAMPLES_NEAR + SIM_SAMPLES_FAR);
+            uint16_t range = i % 2 ? SIM_FINE_RANGE : SIM_FAR_RANGE;
+            uint16_t distance = 200 + random_next() % (range - 200);
+            add_sample(x + lroundf(distance * cosf(angle)), y + lroundf(distance * sinf(angle)), distance);
+        }
+        TILE_Update();
+
+        TILE_GetStats(&stats);
+        assert(stats.dropped == 0);
+        assert(stats.pending == 0);
+
+        int32_t step = revolution < SIM_REVOLUTIONS * 2 / 3 ? SIM_STEP_MM : -SIM_STEP_MM;
+        x += step;
+        y += step / 2;
+    }
+    TILE_Flush();
+
+    // Every hit is read back, from the RAM or from the flash
+    for (uint16_t row = 0; row < SIM_GRID_SIZE; row++)
+    {
+        int32_t cell_y = SIM_GRID_ORIGIN + row * TILE_GetCellSize(TILE_LEVEL_FINE) + 50;
+        TILE_GetRow(TILE_LEVEL_FINE, SIM_GRID_ORIGIN + 50, cell_y, TILE_GetCellSize(TILE_LEVEL_FINE), SIM_GRID_SIZE,
+                    hits);
+        for (uint16_t col = 0; col < SIM_GRID_SIZE; col++)
+        {
+            assert(hits[col] == (sim_grid[row][col] < TILE_HITS_MAX ? sim_grid[row][col] : TILE_HITS_MAX));
+        }
+    }
+
+    // Tiles are only written when the sensor leaves them, not on every revolution
+    TILE_GetStats(&stats);
+    assert(stats.written > 0 && stats.written < sim_record_count * 4);
+    assert(stats.loaded > 0);
+    printf("SUCCESS (%lu tiles written, %u stored)\n", (unsigned long) stats.written, sim_record_count);
+}
+
+static void add_sample(int32_t x, int32_t y, uint16_t distance)
+{
+    TILE_AddPoint(x, y, distance);
+
+    int32_t col = (x - SIM_GRID_ORIGIN) / TILE_GetCellSize(TILE_LEVEL_FINE);
+    int32_t row = (y - SIM_GRID_ORIGIN) / TILE_GetCellSize(TILE_LEVEL_FINE);
+    if (distance <= SIM_FINE_LEVEL_RANGE && x >= SIM_GRID_ORIGIN && y >= SIM_GRID_ORIGIN && col < SIM_GRID_SIZE
+            && row < SIM_GRID_SIZE)
+    {
+        sim_grid[row][col]++;
+    }
+}
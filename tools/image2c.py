@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Convert UI images to the compressed format decoded by Core/Src/image.c.
+
+Usage: image2c.py -o Core/Src/logo.c assets/logo.ppm assets/cross.ppm assets/volume.ppm
+
+Each image becomes an `image_t` named after its file. Binary PPM (P6) files are read directly, other formats
+need Pillow. Colors are reduced to 6 bits per channel like the display does (RGB666), at most 256 colors.
+"""
+
+import argparse
+import os
+import sys
+
+RUN = 0x80
+TOKEN_LENGTH_MAX = 128
+LINE_WIDTH = 120
+
+
+def read_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields = []
+    idx = 0
+    # Magic, width, height and maximum value, separated by whitespace and comments
+    while len(fields) < 4:
+        while data[idx:idx + 1].isspace():
+            idx += 1
+        if data[idx:idx + 1] == b"#":
+            idx = data.index(b"\n", idx)
+            continue
+        start = idx
+        while not data[idx:idx + 1].isspace():
+            idx += 1
+        fields.append(data[start:idx])
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise ValueError("%s: only 8-bit binary PPM (P6) is supported" % path)
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[idx + 1:idx + 1 + width * height * 3]
+    if len(pixels) != width * height * 3:
+        raise ValueError("%s: truncated pixel data" % path)
+    return width, height, pixels
+
+
+def read_image(path):
+    if path.lower().endswith(".ppm"):
+        return read_ppm(path)
+    try:
+        from PIL import Image
+    except ImportError:
+        raise ValueError("%s: Pillow is needed for this format, or convert it to PPM" % path)
+    image = Image.open(path).convert("RGB")
+    return image.width, image.height, image.tobytes()
+
+
+def encode(indexes):
+    """Runs of 2 pixels or more, the other pixels are grouped in literal tokens."""
+    tokens = []
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:TOKEN_LENGTH_MAX]
+            del literal[:TOKEN_LENGTH_MAX]
+            tokens.append(len(chunk) - 1)
+            tokens.extend(chunk)
+
+    i = 0
+    while i < len(indexes):
+        j = i
+        while j < len(indexes) and indexes[j] == indexes[i] and j - i < TOKEN_LENGTH_MAX:
+            j += 1
+        if j - i >= 2:
+            flush()
+            tokens.append(RUN | (j - i - 1))
+            tokens.append(indexes[i])
+        else:
+            literal.append(indexes[i])
+        i = j
+    flush()
+    return tokens
+
+
+def decode(tokens, palette):
+    """Reference decoder, checks the encoding before it is written."""
+    pixels = []
+    i = 0
+    while i < len(tokens):
+        length = (tokens[i] & ~RUN) + 1
+        if tokens[i] & RUN:
+            pixels.extend([palette[tokens[i + 1]]] * length)
+            i += 2
+        else:
+            pixels.extend(palette[index] for index in tokens[i + 1:i + 1 + length])
+            i += 1 + length
+    return pixels
+
+
+def format_array(declaration, values):
+    lines = []
+    line = declaration + " = {"
+    for n, value in enumerate(values):
+        item = "0x%02x" % value + (", " if n < len(values) - 1 else "};")
+        if len(line) + len(item.rstrip()) > LINE_WIDTH:
+            lines.append(line.rstrip())
+            line = " " * 8
+        line += item
+    lines.append(line)
+    return "\n".join(lines)
+
+
+def convert(path):
+    name = os.path.splitext(os.path.basename(path))[0]
+    width, height, data = read_image(path)
+    pixels = [tuple(c & 0xFC for c in data[i:i + 3]) for i in range(0, len(data), 3)]
+    palette = sorted(set(pixels))
+    if len(palette) > 256:
+        raise ValueError("%s: %d colors, 256 at most" % (path, len(palette)))
+    lookup = {color: n for n, color in enumerate(palette)}
+    tokens = encode([lookup[p] for p in pixels])
+    if decode(tokens, palette) != pixels or len(tokens) > 0xFFFF:
+        raise ValueError("%s: encoding failed" % path)
+
+    source = [
+        format_array("static const uint8_t %s_palette[]" % name, [c for color in palette for c in color]),
+        "",
+        format_array("static const uint8_t %s_data[]" % name, tokens),
+        "",
+        "const image_t %s = {.width = %d, .height = %d, .colors = %d, .palette = %s_palette, .data = %s_data," %
+        (name, width, height, len(palette), name, name),
+        "        .size = sizeof(%s_data)};" % name,
+    ]
+    print("%s: %dx%d, %d colors, %d bytes instead of %d" %
+          (name, width, height, len(palette), len(tokens) + 3 * len(palette), len(data)), file=sys.stderr)
+    return "\n".join(source)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", required=True, help="C source to write")
+    parser.add_argument("images", nargs="+")
+    args = parser.parse_args()
+
+    name = os.path.basename(args.output)
+    header = [
+        "/*",
+        " * %s" % name,
+        " *",
+        " *  Generated by tools/image2c.py from %s, do not edit." % ", ".join(args.images),
+        " */",
+        "",
+        '#include "image.h"',
+    ]
+    try:
+        body = [convert(path) for path in args.images]
+    except ValueError as error:
+        sys.exit(str(error))
+    with open(args.output, "w") as f:
+        f.write("\n".join(header) + "\n\n" + "\n\n".join(body) + "\n")
+
+
+if __name__ == "__main__":
+    main()